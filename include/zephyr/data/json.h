@@ -102,6 +102,13 @@ struct json_obj_descr {
 	 */
 	uint32_t type : 7;
 
+#if defined(CONFIG_JSON_LIBRARY_KEY_HASH) || defined(__DOXYGEN__)
+	/* Signature of the field name computed by the macros below,
+	 * checked before comparing the names. 0 if not computed.
+	 */
+	uint32_t field_name_hash : 8;
+#endif
+
 	/* 65535 bytes is more than enough for many JSON payloads. */
 	uint32_t offset : 16;
 
@@ -139,6 +146,18 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 				 __alignof__(type) == 2 ? 1 : \
 				 __alignof__(type) == 4 ? 2 : 3)
 
+/* Signature of a field name string literal, in the 1-255 range */
+#define Z_JSON_NAME_HASH(name_) \
+	((sizeof(name_) > 1) ? \
+	 (((uint8_t)(name_)[0] * 31U + \
+	   (uint8_t)(name_)[sizeof(name_) > 1 ? sizeof(name_) - 2 : 0]) % 255U + 1U) : 0U)
+
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+#define Z_JSON_DESCR_NAME_HASH(name_) .field_name_hash = Z_JSON_NAME_HASH(name_),
+#else
+#define Z_JSON_DESCR_NAME_HASH(name_)
+#endif
+
 /**
  * @brief Helper macro to declare a descriptor for supported primitive
  * values.
@@ -165,6 +184,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(#field_name_) - 1, \
 		.type = type_, \
+		Z_JSON_DESCR_NAME_HASH(#field_name_) \
 		.offset = offsetof(struct_, field_name_), \
 		.field = { \
 			.size = SIZEOF_FIELD(struct_, field_name_) \
@@ -201,6 +221,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = (sizeof(#field_name_) - 1), \
 		.type = JSON_TOK_OBJECT_START, \
+		Z_JSON_DESCR_NAME_HASH(#field_name_) \
 		.offset = offsetof(struct_, field_name_), \
 		.object = { \
 			.sub_descr = sub_descr_, \
@@ -296,6 +317,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(#field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(#field_name_) \
 		.offset = offsetof(struct_, field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR(struct_, len_field_, \
@@ -346,6 +368,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(#field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(#field_name_) \
 		.offset = offsetof(struct_, field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR(struct_, len_field_, \
@@ -405,6 +428,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(#field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(#field_name_) \
 		.offset = offsetof(struct_, field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR( \
@@ -440,6 +464,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(#json_field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(#json_field_name_) \
 		.offset = offsetof(struct_, struct_field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR( \
@@ -472,6 +497,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(json_field_name_) - 1, \
 		.type = type_, \
+		Z_JSON_DESCR_NAME_HASH(json_field_name_) \
 		.offset = offsetof(struct_, struct_field_name_), \
 		.field = { \
 			.size = SIZEOF_FIELD(struct_, struct_field_name_) \
@@ -498,6 +524,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = (sizeof(json_field_name_) - 1), \
 		.type = JSON_TOK_OBJECT_START, \
+		Z_JSON_DESCR_NAME_HASH(json_field_name_) \
 		.offset = offsetof(struct_, struct_field_name_), \
 		.object = { \
 			.sub_descr = sub_descr_, \
@@ -529,6 +556,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(json_field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(json_field_name_) \
 		.offset = offsetof(struct_, struct_field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR(struct_, len_field_, \
@@ -587,6 +615,7 @@ typedef int (*json_append_bytes_t)(const char *bytes, size_t len,
 		.align_shift = Z_ALIGN_SHIFT(struct_), \
 		.field_name_len = sizeof(json_field_name_) - 1, \
 		.type = JSON_TOK_ARRAY_START, \
+		Z_JSON_DESCR_NAME_HASH(json_field_name_) \
 		.offset = offsetof(struct_, struct_field_name_), \
 		.array = { \
 			.element_descr = Z_JSON_ELEMENT_DESCR(struct_, len_field_, \
@@ -700,6 +729,99 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+struct json_obj_stream_frame {
+	/* Object: field descriptors; array: element descriptor */
+	const struct json_obj_descr *descr;
+	/* Object: number of fields; array: maximum number of elements */
+	size_t descr_len;
+	/* Object: struct holding the fields; array: first element */
+	void *val;
+	/* Array: number of elements decoded */
+	size_t *count;
+	/* Object: bitmap of decoded fields */
+	int64_t decoded;
+	/* Object: field being parsed, descr_len if it is skipped */
+	size_t field;
+	bool array;
+};
+/** @endcond */
+
+/**
+ * @brief State of an incremental object parser
+ *
+ * Set up with json_obj_stream_init(). The members are private.
+ */
+struct json_obj_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct json_obj_stream_frame frames[CONFIG_JSON_LIBRARY_STREAM_DEPTH];
+	/* Bitmap of decoded fields once done, or error */
+	int64_t result;
+	uint8_t depth;
+	uint8_t expect;
+	uint8_t lex;
+	bool tok_overflow;
+	/* Nesting level of the value being skipped */
+	uint16_t skip;
+	uint16_t tok_len;
+	char tok[CONFIG_JSON_LIBRARY_STREAM_TOKEN_SIZE + 1];
+	/** @endcond */
+};
+
+/**
+ * @brief Start the incremental parsing of a JSON-encoded object
+ *
+ * The object is then fed with json_obj_stream_feed() in chunks of any size,
+ * e.g. the fragments of a network buffer as they are received, without
+ * assembling the document in a single buffer. The values are stored in the
+ * struct pointed to by @a val as with json_obj_parse().
+ *
+ * Since the input chunks are not kept, values are copied as they are decoded
+ * and fields pointing into the input (JSON_TOK_STRING, JSON_TOK_OPAQUE,
+ * JSON_TOK_FLOAT, JSON_TOK_ENCODED_OBJ, JSON_TOK_OBJ_ARRAY and mixed arrays)
+ * as well as arrays of arrays are not supported: use JSON_TOK_STRING_BUF for
+ * strings. Strings and numbers longer than
+ * CONFIG_JSON_LIBRARY_STREAM_TOKEN_SIZE are rejected, unless they belong to
+ * a field which is not described, and objects and arrays can be nested up
+ * to CONFIG_JSON_LIBRARY_STREAM_DEPTH levels.
+ *
+ * @param stream Parser state
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be less
+ * than 63.
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val);
+
+/**
+ * @brief Feed the next chunk of a JSON-encoded object
+ *
+ * Data following the end of the object is ignored.
+ *
+ * @param stream Parser state
+ * @param data Pointer to the chunk
+ * @param len Length of the chunk
+ *
+ * @return 0 on success. A negative value indicates an error (as defined on
+ * errno.h), which is also returned by the following calls.
+ */
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Finish the incremental parsing of a JSON-encoded object
+ *
+ * @param stream Parser state
+ *
+ * @return < 0 if error or if the object is not complete, bitmap of decoded
+ * fields on success, as with json_obj_parse().
+ */
+int64_t json_obj_stream_finish(struct json_obj_stream *stream);
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
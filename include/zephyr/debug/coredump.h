@@ -11,6 +11,9 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/toolchain.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -140,6 +143,40 @@ struct coredump_cmd_copy_arg {
 	size_t length;
 };
 
+/** Memory region registered with @ref COREDUMP_MEMORY_REGION_DEFINE */
+struct coredump_memory_region {
+	/** Start address of the region */
+	const void *start;
+
+	/** Size of the region in bytes */
+	size_t size;
+};
+
+/**
+ * @brief Register a memory region to be included in coredumps.
+ *
+ * Registered regions are dumped right after the faulting thread, before
+ * the rest of the memory selected by the memory dump policy, so they are
+ * still captured when the backend runs out of space.
+ *
+ * @param _name Name of the region definition.
+ * @param _start Start address of the region.
+ * @param _size Size of the region in bytes.
+ */
+#if defined(CONFIG_DEBUG_COREDUMP)
+#define COREDUMP_MEMORY_REGION_DEFINE(_name, _start, _size)                                        \
+	static const STRUCT_SECTION_ITERABLE(coredump_memory_region, _name) = {                    \
+		.start = (_start),                                                                 \
+		.size = (_size),                                                                   \
+	}
+#else
+#define COREDUMP_MEMORY_REGION_DEFINE(_name, _start, _size)                                        \
+	static const struct coredump_memory_region _name __unused = {                              \
+		.start = (_start),                                                                 \
+		.size = (_size),                                                                   \
+	}
+#endif
+
 #ifdef CONFIG_DEBUG_COREDUMP
 
 #include <zephyr/toolchain.h>
@@ -148,6 +185,9 @@ struct coredump_cmd_copy_arg {
 
 #define COREDUMP_HDR_VER		2
 
+/* Everything following the coredump header is compressed */
+#define COREDUMP_HDR_FLAG_COMPRESSED	BIT(0)
+
 #define	COREDUMP_ARCH_HDR_ID		'A'
 
 #define THREADS_META_HDR_ID		'T'
@@ -181,6 +221,7 @@ struct coredump_hdr_t {
 	/* Pointer size in Log2 */
 	uint8_t		ptr_size_bits;
 
+	/* COREDUMP_HDR_FLAG_* */
 	uint8_t		flag;
 
 	/* Coredump Reason given */
@@ -469,6 +469,11 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_INIT_TIME) || defined(__DOXYGEN__)
+	/** Duration of the initialization function, in hardware cycles */
+	uint32_t init_cycles;
+#endif /* CONFIG_DEVICE_INIT_TIME */
 };
 
 struct pm_device_base;
@@ -883,6 +888,20 @@ __syscall bool device_is_ready(const struct device *dev);
  */
 __syscall int device_init(const struct device *dev);
 
+#if defined(CONFIG_DEVICE_INIT_TIME) || defined(__DOXYGEN__)
+/**
+ * @brief Get the time taken by the initialization of a device.
+ *
+ * @note Requires @kconfig{CONFIG_DEVICE_INIT_TIME}.
+ *
+ * @param dev device in question.
+ *
+ * @return Duration of the last call to the device initialization function in
+ * microseconds, 0 if it has not been called.
+ */
+uint32_t device_init_time_get(const struct device *dev);
+#endif /* CONFIG_DEVICE_INIT_TIME */
+
 /**
  * @brief De-initialize a device.
  *
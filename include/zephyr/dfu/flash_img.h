@@ -31,6 +31,9 @@ extern "C" {
 
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#ifdef CONFIG_IMG_BLOCK_DOUBLE_BUFFER
+	uint8_t buf2[CONFIG_IMG_BLOCK_BUF_SIZE];
+#endif
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
 };
@@ -49,6 +52,9 @@ struct flash_img_check {
 /**
  * @brief Initialize context needed for writing the image to the flash.
  *
+ * With CONFIG_IMG_BLOCK_DOUBLE_BUFFER the context must be zero-initialized
+ * before it is first used, e.g. static or allocated with k_calloc().
+ *
  * @param ctx     context to be initialized
  * @param area_id flash area id of partition where the image should be written
  *
@@ -84,6 +84,34 @@ struct fcb_entry_ctx {
  */
 #define FCB_FLAGS_CRC_DISABLED BIT(0)
 
+#if defined(CONFIG_FCB_INDEX) || defined(__DOXYGEN__)
+struct fcb;
+
+/**
+ * @brief RAM index record of a valid FCB entry
+ */
+struct fcb_index_entry {
+	uint32_t fie_elem_off; /**< Offset of the entry from the sector start */
+	uint32_t fie_tag; /**< User tag, see @ref fcb_index_tag_cb */
+	uint16_t fie_sector; /**< Index of the sector in fcb::f_sectors */
+	uint16_t fie_data_len; /**< Size of data area in fcb entry */
+};
+
+/**
+ * @brief Compute the index tag of an entry
+ *
+ * Called for every entry added to the index, the returned value is stored
+ * with the entry and can be searched with @ref fcb_index_find. Typically a
+ * hash of the key the entry stores.
+ *
+ * @param[in] fcbp FCB instance structure.
+ * @param[in] loc  entry location information
+ *
+ * @return tag of the entry
+ */
+typedef uint32_t (*fcb_index_tag_cb)(struct fcb *fcbp, const struct fcb_entry *loc);
+#endif /* CONFIG_FCB_INDEX */
+
 /**
  * @brief FCB instance structure
  *
@@ -141,6 +169,25 @@ struct fcb {
 	const uint8_t f_flags;
 	/**< Flags for configuring the FCB. */
 #endif
+#if defined(CONFIG_FCB_INDEX) || defined(__DOXYGEN__)
+	struct fcb_index_entry *f_index;
+	/**< Storage for the RAM index of entries, internal state. Set by
+	 * fcb_index_attach, NULL when the instance has no index.
+	 */
+
+	uint16_t f_index_size;
+	/**< Number of records in f_index, internal state */
+
+	fcb_index_tag_cb f_index_tag;
+	/**< Optional tag callback, internal state */
+
+	uint16_t f_index_head; /**< First (oldest) index record, internal state */
+	uint16_t f_index_cnt; /**< Number of index records, internal state */
+	bool f_index_valid;
+	/**< Index covers all entries, internal state. It is rebuilt on rotate
+	 * when it has overflowed.
+	 */
+#endif
 };
 
 /**
@@ -303,6 +350,45 @@ int fcb_offset_last_n(struct fcb *fcbp, uint8_t entries, struct fcb_entry *last_
  */
 int fcb_clear(struct fcb *fcbp);
 
+#if defined(CONFIG_FCB_INDEX) || defined(__DOXYGEN__)
+/**
+ * Attach a RAM index to an FCB instance.
+ *
+ * Fills @p index from flash, after which the index is maintained on append
+ * and rotate. Walking over the entries is then served from RAM, and entries
+ * can be looked up by tag with @ref fcb_index_find. Must be called after
+ * @ref fcb_init, which detaches any index the instance had.
+ *
+ * @param[in] fcbp   FCB instance structure.
+ * @param[in] index  Storage for the index records.
+ * @param[in] size   Number of records @p index can hold.
+ * @param[in] tag_cb Optional callback computing the tag of an entry.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL on invalid arguments.
+ */
+int fcb_index_attach(struct fcb *fcbp, struct fcb_index_entry *index, uint16_t size,
+		     fcb_index_tag_cb tag_cb);
+
+/**
+ * Find the next entry with the given index tag.
+ *
+ * Looks up the RAM index for the first entry following the one pointed by
+ * @p loc, with the same starting rules as @ref fcb_getnext, whose tag equals
+ * @p tag. No flash access is done.
+ *
+ * @param[in] fcbp FCB instance structure.
+ * @param[in] tag  tag to look for
+ * @param[in,out] loc entry location information
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if there are no more matching entries.
+ * @retval -ENOENT if the index is not available; callers have to fall back
+ *         to @ref fcb_getnext.
+ */
+int fcb_index_find(struct fcb *fcbp, uint32_t tag, struct fcb_entry *loc);
+#endif
+
 /**
  * @}
  */
@@ -32,6 +32,7 @@ enum instr_event_types {
 	INSTR_EVENT_PROFILE,	/**< Profile events */
 	INSTR_EVENT_SCHED_IN,	/**< Thread switched in scheduler event */
 	INSTR_EVENT_SCHED_OUT,	/**< Thread switched out scheduler event */
+	INSTR_EVENT_PROFILE_STATS, /**< Per function call statistics */
 	INSTR_EVENT_NUM,	/**< Add more events above this one */
 	INSTR_EVENT_INVALID	/**< Invalid or no event generated after promotion */
 } __packed;
@@ -184,6 +185,54 @@ void instr_dump_buffer_uart(void);
  */
 void instr_dump_deltas_uart(void);
 
+/**
+ * @brief Dumps per function call statistics via UART (profiling).
+ *
+ * Functions are sorted by decreasing inclusive or exclusive (callees not
+ * included) time.
+ *
+ * @param top_n     Maximum number of functions to dump, 0 for all.
+ * @param inclusive Sort by inclusive time instead of exclusive time.
+ */
+void instr_dump_stats_uart(uint32_t top_n, bool inclusive);
+
+/**
+ * @brief Clears collected profile info and resumes collection (profiling).
+ */
+void instr_profile_reset(void);
+
+/**
+ * @brief Restrict instrumentation to, or exclude, an address range at runtime.
+ *
+ * When at least one include range is set, only functions inside an include
+ * range are instrumented. Exclude ranges take precedence over include ranges.
+ * Scheduler events are never filtered out of traces.
+ *
+ * @param start   Start address of the range, usually a function address.
+ * @param end     End address of the range, exclusive.
+ * @param include true for an include range, false for an exclude range.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the range is empty.
+ * @retval -ENOMEM if CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES ranges are already set.
+ * @retval -ENOTSUP if runtime filters are disabled.
+ */
+int instr_filter_add(void *start, void *end, bool include);
+
+/**
+ * @brief Remove all runtime include and exclude ranges.
+ */
+void instr_filter_clear(void);
+
+/**
+ * @brief Tells if a function passes the runtime include and exclude ranges.
+ *
+ * @param callee The function address
+ *
+ * @return true if the function is instrumented, false otherwise.
+ */
+bool instr_filter_pass(void *callee);
+
 /**
  * @brief Shared callback handler to process entry/exit events.
  *
@@ -636,6 +636,34 @@ int k_thread_runtime_stack_safety_threshold_check(const struct k_thread *thread,
 						  void *arg);
 #endif
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK) || defined(__DOXYGEN__)
+/**
+ * @brief Obtain the stack high-water mark of the specified thread
+ *
+ * Unlike k_thread_stack_space_get(), this does not scan the stack buffer: it
+ * returns the deepest stack usage sampled when the thread was switched out,
+ * or when it calls this function on itself. The stack pointer is not sampled
+ * on interrupt entry or exit, so only the depth at context switches is
+ * caught: deeper calls that return before the next switch, and interrupt
+ * frames pushed on the thread stack, are not seen. The value is thus a lower
+ * bound of the real usage.
+ *
+ * @param thread Thread to inspect stack information
+ * @param used_ptr Output parameter, filled in with the stack high-water mark
+ *	of the target thread in bytes.
+ * @return 0 on success
+ * @return -EINVAL Thread stack is not mapped
+ */
+int k_thread_stack_watermark_get(const struct k_thread *thread, size_t *used_ptr);
+
+/**
+ * @brief Reset the stack high-water mark of the specified thread
+ *
+ * @param thread Thread whose high-water mark is reset
+ */
+void k_thread_stack_watermark_reset(struct k_thread *thread);
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 /**
  * @brief Assign the system heap as a thread's resource pool
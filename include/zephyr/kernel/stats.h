@@ -27,6 +27,27 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_WAIT) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_WAIT is selected.
+	 * @{
+	 */
+	uint64_t  ready_wait;         /**< \# of cycles ready, waiting for a CPU */
+	uint64_t  longest_ready_wait; /**< \# of cycles of the longest ready wait */
+	uint64_t  blocked;            /**< \# of cycles blocked */
+	uint64_t  longest_blocked;    /**< \# of cycles of the longest block */
+	uint32_t  num_ready_waits;    /**< \# of ready waits */
+	uint32_t  num_blocks;         /**< \# of blocks */
+	uint32_t  ready0;             /**< start of the ready wait, 0 if none */
+	uint32_t  blocked0;           /**< start of the block, 0 if none */
+#if (CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS > 0) || defined(__DOXYGEN__)
+	/** Ready wait histogram, see CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_SHIFT */
+	uint32_t  ready_wait_hist[CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS];
+	/** Blocked histogram, see CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_SHIFT */
+	uint32_t  blocked_hist[CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS];
+#endif
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
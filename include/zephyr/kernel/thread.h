@@ -178,6 +178,11 @@ struct _thread_stack_info {
 #if defined(CONFIG_THREAD_RUNTIME_STACK_SAFETY)
 	struct _thread_stack_usage usage;
 #endif
+
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+	/* Deepest stack usage seen at a context switch, in bytes */
+	size_t watermark;
+#endif
 };
 
 typedef struct _thread_stack_info _thread_stack_info_t;
@@ -237,6 +242,30 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+	/*
+	 * Time spent by threads ready but waiting for a CPU, and off CPU
+	 * while blocked (pending, sleeping or suspended). A wait in progress
+	 * is included. Always zero for CPUs.
+	 */
+
+	uint64_t ready_wait_cycles;      /* total # of cycles ready, not running */
+	uint64_t peak_ready_wait_cycles; /* longest ready wait */
+	uint64_t blocked_cycles;         /* total # of cycles blocked */
+	uint64_t peak_blocked_cycles;    /* longest block */
+	uint32_t num_ready_waits;        /* # of ready waits */
+	uint32_t num_blocks;             /* # of blocks */
+#if CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS > 0
+	/*
+	 * Power of two histograms, bucket 0 counts waits shorter than
+	 * 2^CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_SHIFT cycles and the
+	 * last bucket all waits too long for the previous one.
+	 */
+	uint32_t ready_wait_histogram[CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS];
+	uint32_t blocked_histogram[CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS];
+#endif
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -201,6 +201,31 @@ extern "C" {
 	 Z_LOG_STATIC_INST_LEVEL_CHECK(_level, _inst, _source) &&                                  \
 	 Z_LOG_DYNAMIC_LEVEL_CHECK(_level, _source))
 
+/** @internal
+ *
+ * @brief Check per source rate limit.
+ *
+ * @param source Dynamic data associated with the source.
+ *
+ * @retval true Continue with log message creation.
+ * @retval false Drop that message.
+ */
+bool z_log_source_limit_check(const void *source);
+
+/** @brief Per source rate limit check.
+ *
+ * Performed after level checks and before message is packaged. Messages logged
+ * from the user context are not limited.
+ *
+ * @param _source Data associated with the source.
+ *
+ * @retval true Continue with log message creation.
+ * @retval false Drop that message.
+ */
+#define Z_LOG_SOURCE_LIMIT_CHECK(_source)                                                          \
+	(!IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT) || k_is_user_context() ||                        \
+	 z_log_source_limit_check(_source))
+
 /** @brief Get current module data that is used for source id retrieving.
  *
  * If runtime filtering is used then pointer to dynamic data is returned and else constant
@@ -298,6 +323,9 @@ static inline char z_log_minimal_level_to_char(int level)
 			Z_LOG_TO_PRINTK(_level, __VA_ARGS__);                                      \
 			break;                                                                     \
 		}                                                                                  \
+		if (!Z_LOG_SOURCE_LIMIT_CHECK(_source)) {                                          \
+			break;                                                                     \
+		}                                                                                  \
 		int _mode;                                                                         \
 		bool string_ok;                                                                    \
 		LOG_POINTERS_VALIDATE(string_ok, __VA_ARGS__);                                     \
@@ -355,6 +383,9 @@ static inline char z_log_minimal_level_to_char(int level)
 			z_log_minimal_hexdump_print((_level), (const char *)(_data), (_len));      \
 			break;                                                                     \
 		}                                                                                  \
+		if (!Z_LOG_SOURCE_LIMIT_CHECK(_source)) {                                          \
+			break;                                                                     \
+		}                                                                                  \
 		int _mode;                                                                         \
 		Z_LOG_MSG_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), _mode,                    \
 				 Z_LOG_LOCAL_DOMAIN_ID, _source, _level, _data, _len,              \
@@ -207,6 +207,65 @@ uint32_t log_frontend_filter_get(int16_t source_id, bool runtime);
  */
 __syscall uint32_t log_frontend_filter_set(int16_t source_id, uint32_t level);
 
+/**
+ * @brief Set rate limit of a source.
+ *
+ * Source is allowed to log @p burst messages back to back and then @p rate
+ * messages per second. Requires CONFIG_LOG_SOURCE_RATELIMIT.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param rate		Messages per second, 0 disables rate limiting.
+ * @param burst		Maximum number of messages logged back to back.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if source does not exist or @p burst is 0.
+ * @retval -ENOTSUP if feature is disabled or domain is not the local domain.
+ */
+int log_source_ratelimit_set(uint32_t domain_id, int16_t source_id,
+			     uint16_t rate, uint16_t burst);
+
+/**
+ * @brief Get rate limit of a source.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param[out] rate	Messages per second, 0 if rate limiting is disabled.
+ * @param[out] burst	Maximum number of messages logged back to back.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if source does not exist.
+ * @retval -ENOTSUP if feature is disabled or domain is not the local domain.
+ */
+int log_source_ratelimit_get(uint32_t domain_id, int16_t source_id,
+			     uint16_t *rate, uint16_t *burst);
+
+/**
+ * @brief Enable or disable repeated messages suppression for a source.
+ *
+ * Consecutive identical messages, with the same level, format string,
+ * arguments and hexdump data, are suppressed. Requires CONFIG_LOG_SOURCE_DEDUP.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ * @param enable	True to suppress repeated messages.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if source does not exist.
+ * @retval -ENOTSUP if feature is disabled or domain is not the local domain.
+ */
+int log_source_dedup_set(uint32_t domain_id, int16_t source_id, bool enable);
+
+/**
+ * @brief Check if repeated messages suppression is enabled for a source.
+ *
+ * @param domain_id	ID of the domain.
+ * @param source_id	Source (module or instance) ID.
+ *
+ * @return True if repeated messages are suppressed.
+ */
+bool log_source_dedup_get(uint32_t domain_id, int16_t source_id);
+
 /**
  *
  * @brief Enable backend with initial maximum filtering level.
@@ -19,9 +19,33 @@ struct log_source_const_data {
 	uint8_t level;
 };
 
+#if defined(CONFIG_LOG_SOURCE_RATELIMIT) || defined(CONFIG_LOG_SOURCE_DEDUP)
+/** @brief Rate limiting and repeated messages suppression state of a source. */
+struct log_source_limit {
+#if defined(CONFIG_LOG_SOURCE_DEDUP)
+	uint32_t last_hash;
+	uint32_t repeat_ts;
+	uint16_t repeat_cnt;
+	uint8_t repeat_level;
+	bool dedup;
+#endif
+#if defined(CONFIG_LOG_SOURCE_RATELIMIT)
+	uint32_t refill_ts;
+	uint32_t dropped;
+	uint16_t rate;
+	uint16_t burst;
+	uint16_t tokens;
+#endif
+};
+#endif
+
 /** @brief Dynamic data associated with the source of log messages. */
 struct log_source_dynamic_data {
 	uint32_t filters;
+#if defined(CONFIG_LOG_SOURCE_RATELIMIT) || defined(CONFIG_LOG_SOURCE_DEDUP)
+	/* Pointer aligned to keep the structure size a multiple of 8 bytes on 64 bit. */
+	struct log_source_limit limit __aligned(sizeof(void *));
+#endif
 #if defined(CONFIG_64BIT)
 	/* Workaround: Ensure that structure size is a multiple of 8 bytes. */
 	uint32_t dummy_64;
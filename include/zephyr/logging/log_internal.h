@@ -60,6 +60,36 @@ void z_log_free(void *buf);
 /* Initialize runtime filters */
 void z_log_runtime_filters_init(void);
 
+/* Initialize per source rate limits and repeated messages suppression. */
+void z_log_source_limit_init(void);
+
+/* Period of reporting messages suppressed by sources which stopped logging. */
+#define Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS                                                         \
+	COND_CODE_1(CONFIG_LOG_SOURCE_DEDUP, (CONFIG_LOG_SOURCE_DEDUP_PERIOD_MS), (MSEC_PER_SEC))
+
+/* Report messages suppressed by sources which stopped logging.
+ *
+ * @return True if there are still suppressed messages to be reported.
+ */
+bool z_log_source_limit_flush(void);
+
+/* Check if a message repeats the previous message of its source.
+ *
+ * Called when the message is processed. Reports the suppressed repetitions
+ * of the previous message before the message is passed to the backends.
+ *
+ * @param msg Message.
+ *
+ * @return False if the message is a repetition and must be dropped.
+ */
+bool z_log_source_dedup_check(union log_msg_generic *msg);
+
+/* Pass a message to the active backends.
+ *
+ * @param msg Message.
+ */
+void z_log_msg_dispatch(union log_msg_generic *msg);
+
 /* Initialize links. */
 void z_log_links_initiate(void);
 
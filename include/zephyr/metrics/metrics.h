@@ -0,0 +1,316 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Hot path metrics.
+ *
+ * Counters and latency histograms cheap enough to be updated from kernel
+ * and network hot paths, including ISRs. Each metric keeps one slot per CPU,
+ * on its own cache line on SMP systems, which is only updated with atomic
+ * operations by the CPU that owns it. Slots are aggregated only when the
+ * metric is read, e.g. from the shell or on a Prometheus scrape.
+ *
+ * Histograms are log-linear: values are grouped by power of two and each
+ * group is split into 2^CONFIG_METRICS_HISTOGRAM_SUB_BITS linear buckets.
+ */
+
+#ifndef ZEPHYR_INCLUDE_METRICS_METRICS_H_
+#define ZEPHYR_INCLUDE_METRICS_METRICS_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_METRICS_PROMETHEUS
+#include <zephyr/net/prometheus/counter.h>
+#include <zephyr/net/prometheus/histogram.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hot path metrics
+ * @defgroup metrics Hot path metrics
+ * @ingroup os_services
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+#ifdef CONFIG_SMP
+#define METRICS_CPU_ALIGN CONFIG_METRICS_CACHE_LINE_SIZE
+#define METRICS_CPU_ID()  (arch_curr_cpu()->id)
+#else
+#define METRICS_CPU_ALIGN sizeof(atomic_t)
+#define METRICS_CPU_ID()  0
+#endif
+
+#define METRICS_HISTOGRAM_SUB_BITS CONFIG_METRICS_HISTOGRAM_SUB_BITS
+#define METRICS_HISTOGRAM_MAX_BITS CONFIG_METRICS_HISTOGRAM_MAX_BITS
+
+struct metrics_counter_cpu {
+	atomic_t value;
+} __aligned(METRICS_CPU_ALIGN);
+
+/** @endcond */
+
+/** Number of buckets of a histogram, including the overflow bucket. */
+#define METRICS_HISTOGRAM_BUCKETS                                                                  \
+	((((METRICS_HISTOGRAM_MAX_BITS) - (METRICS_HISTOGRAM_SUB_BITS) + 1)                        \
+	  << (METRICS_HISTOGRAM_SUB_BITS)) + 1)
+
+/** @cond INTERNAL_HIDDEN */
+
+struct metrics_histogram_cpu {
+	atomic_t buckets[METRICS_HISTOGRAM_BUCKETS];
+	atomic_t sum;
+} __aligned(METRICS_CPU_ALIGN);
+
+/** @endcond */
+
+/**
+ * @brief Counter.
+ *
+ * Use METRICS_COUNTER_DEFINE() to define one.
+ */
+struct metrics_counter {
+	/** Name of the counter */
+	const char *name;
+	/** Description of the counter */
+	const char *description;
+	/** @cond INTERNAL_HIDDEN */
+	struct metrics_counter_cpu *cpu;
+	/* Per CPU values may wrap, they are accumulated on read. */
+	uint64_t total;
+	unsigned long last[CONFIG_MP_MAX_NUM_CPUS];
+#ifdef CONFIG_METRICS_PROMETHEUS
+	struct prometheus_counter prom;
+#endif
+	/** @endcond */
+};
+
+/**
+ * @brief Histogram.
+ *
+ * Use METRICS_HISTOGRAM_DEFINE() to define one.
+ */
+struct metrics_histogram {
+	/** Name of the histogram */
+	const char *name;
+	/** Description of the histogram */
+	const char *description;
+	/** @cond INTERNAL_HIDDEN */
+	struct metrics_histogram_cpu *cpu;
+	uint64_t sum;
+	unsigned long last_sum[CONFIG_MP_MAX_NUM_CPUS];
+#ifdef CONFIG_METRICS_PROMETHEUS
+	struct prometheus_histogram prom;
+	struct prometheus_histogram_bucket prom_buckets[METRICS_HISTOGRAM_BUCKETS];
+#endif
+	/** @endcond */
+};
+
+/** @brief Aggregated content of a histogram. */
+struct metrics_histogram_snapshot {
+	/** Number of observations in each bucket, not cumulative */
+	unsigned long buckets[METRICS_HISTOGRAM_BUCKETS];
+	/** Total number of observations */
+	uint64_t count;
+	/** Sum of all observed values */
+	uint64_t sum;
+};
+
+/**
+ * @brief Define a counter.
+ *
+ * @param _name Name of the counter, also used as the variable name.
+ * @param _desc Description of the counter.
+ */
+#define METRICS_COUNTER_DEFINE(_name, _desc)                                                       \
+	static struct metrics_counter_cpu _CONCAT(_name, _cpu)[CONFIG_MP_MAX_NUM_CPUS];            \
+	STRUCT_SECTION_ITERABLE(metrics_counter, _name) = {                                        \
+		.name = STRINGIFY(_name),                                                          \
+		.description = _desc,                                                              \
+		.cpu = _CONCAT(_name, _cpu),                                                       \
+	}
+
+/**
+ * @brief Define a histogram.
+ *
+ * @param _name Name of the histogram, also used as the variable name.
+ * @param _desc Description of the histogram.
+ */
+#define METRICS_HISTOGRAM_DEFINE(_name, _desc)                                                     \
+	static struct metrics_histogram_cpu _CONCAT(_name, _cpu)[CONFIG_MP_MAX_NUM_CPUS];          \
+	STRUCT_SECTION_ITERABLE(metrics_histogram, _name) = {                                      \
+		.name = STRINGIFY(_name),                                                          \
+		.description = _desc,                                                              \
+		.cpu = _CONCAT(_name, _cpu),                                                       \
+	}
+
+/**
+ * @brief Add a value to a counter.
+ *
+ * Lock free and callable from ISRs. Only meant for kernel mode callers.
+ *
+ * @param counter Counter.
+ * @param value Value to add.
+ */
+static inline void metrics_counter_add(struct metrics_counter *counter, unsigned long value)
+{
+	(void)atomic_add(&counter->cpu[METRICS_CPU_ID()].value, (atomic_val_t)value);
+}
+
+/**
+ * @brief Increment a counter.
+ *
+ * @param counter Counter.
+ */
+static inline void metrics_counter_inc(struct metrics_counter *counter)
+{
+	metrics_counter_add(counter, 1U);
+}
+
+/**
+ * @brief Get the bucket index of a value.
+ *
+ * Values below 2^CONFIG_METRICS_HISTOGRAM_SUB_BITS have a bucket each, values
+ * not fitting on CONFIG_METRICS_HISTOGRAM_MAX_BITS go to the last bucket.
+ *
+ * @param value Observed value.
+ *
+ * @return Bucket index.
+ */
+static inline uint32_t metrics_histogram_index(uint32_t value)
+{
+	uint32_t msb;
+	uint32_t shift;
+
+	if (value < BIT(METRICS_HISTOGRAM_SUB_BITS)) {
+		return value;
+	}
+
+	msb = 31U - u32_count_leading_zeros(value);
+	if (msb >= METRICS_HISTOGRAM_MAX_BITS) {
+		return METRICS_HISTOGRAM_BUCKETS - 1;
+	}
+
+	shift = msb - METRICS_HISTOGRAM_SUB_BITS;
+
+	return ((shift + 1U) << METRICS_HISTOGRAM_SUB_BITS) +
+	       ((value >> shift) - BIT(METRICS_HISTOGRAM_SUB_BITS));
+}
+
+/**
+ * @brief Record a value in a histogram.
+ *
+ * Lock free and callable from ISRs. Only meant for kernel mode callers.
+ *
+ * @param histogram Histogram.
+ * @param value Observed value.
+ */
+static inline void metrics_histogram_observe(struct metrics_histogram *histogram,
+					     uint32_t value)
+{
+	struct metrics_histogram_cpu *cpu = &histogram->cpu[METRICS_CPU_ID()];
+
+	(void)atomic_inc(&cpu->buckets[metrics_histogram_index(value)]);
+	(void)atomic_add(&cpu->sum, (atomic_val_t)value);
+}
+
+/**
+ * @brief Get the largest value which goes to a bucket.
+ *
+ * @param index Bucket index.
+ *
+ * @return Inclusive upper bound of the bucket, UINT32_MAX for the last one.
+ */
+uint32_t metrics_histogram_bucket_max(uint32_t index);
+
+/**
+ * @brief Get the value of a counter.
+ *
+ * Sums the per CPU values. The result does not wrap as long as the counter
+ * is read before any per CPU value wraps twice.
+ *
+ * @param counter Counter.
+ *
+ * @return Counter value.
+ */
+uint64_t metrics_counter_get(struct metrics_counter *counter);
+
+/**
+ * @brief Reset a counter to zero.
+ *
+ * @param counter Counter.
+ */
+void metrics_counter_reset(struct metrics_counter *counter);
+
+/**
+ * @brief Aggregate the content of a histogram.
+ *
+ * Buckets are read one by one while they may be updated, so the snapshot is
+ * not atomic with respect to concurrent observations.
+ *
+ * @param histogram Histogram.
+ * @param snapshot Snapshot to fill.
+ */
+void metrics_histogram_snapshot(struct metrics_histogram *histogram,
+				struct metrics_histogram_snapshot *snapshot);
+
+/**
+ * @brief Reset a histogram.
+ *
+ * Observations done concurrently may be lost.
+ *
+ * @param histogram Histogram.
+ */
+void metrics_histogram_reset(struct metrics_histogram *histogram);
+
+/**
+ * @brief Find a counter by name.
+ *
+ * @param name Name of the counter.
+ *
+ * @return Counter, or NULL if not found.
+ */
+struct metrics_counter *metrics_counter_get_by_name(const char *name);
+
+/**
+ * @brief Find a histogram by name.
+ *
+ * @param name Name of the histogram.
+ *
+ * @return Histogram, or NULL if not found.
+ */
+struct metrics_histogram *metrics_histogram_get_by_name(const char *name);
+
+#if defined(CONFIG_METRICS_PROMETHEUS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the Prometheus collector of all metrics.
+ *
+ * Pass it to prometheus_format_exposition() or
+ * prometheus_collector_walk_metrics() to export the metrics.
+ *
+ * @return Collector.
+ */
+struct prometheus_collector *metrics_prometheus_collector(void);
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_METRICS_METRICS_H_ */
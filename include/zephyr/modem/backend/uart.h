@@ -9,6 +9,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/ring_buffer_spsc.h>
 #include <zephyr/sys/atomic.h>
 
 #include <zephyr/modem/pipe.h>
@@ -22,11 +23,10 @@ extern "C" {
 #endif
 
 struct modem_backend_uart_isr {
-	struct ring_buf receive_rdb[2];
-	struct ring_buf transmit_rb;
-	atomic_t transmit_buf_len;
-	atomic_t receive_buf_len;
-	uint8_t receive_rdb_used;
+	/* Filled by the UART ISR, read by the pipe */
+	struct ring_buf_spsc receive_rb;
+	/* Filled by the pipe, drained by the UART ISR */
+	struct ring_buf_spsc transmit_rb;
 	uint32_t transmit_buf_put_limit;
 };
 
@@ -60,8 +60,8 @@ struct modem_backend_uart_async {
 	struct modem_backend_uart_async_common common;
 	uint8_t *receive_bufs[2];
 	uint32_t receive_buf_size;
-	struct ring_buf receive_rb;
-	struct k_spinlock receive_rb_lock;
+	/* Filled by the UART event handler, read by the pipe */
+	struct ring_buf_spsc receive_rb;
 };
 
 #endif /* CONFIG_MODEM_BACKEND_UART_ASYNC_HWFC */
@@ -1325,6 +1325,95 @@ extern const struct net_buf_data_cb net_buf_var_cb;
 					 _net_buf_##_name, _count, _ud_size,   \
 					 _destroy)
 
+/** @cond INTERNAL_HIDDEN */
+
+struct net_buf_arena_block {
+	/* Offset of the first unallocated byte */
+	uint32_t used;
+	/* Number of live allocations */
+	uint16_t live;
+};
+
+struct net_buf_arena {
+	struct k_spinlock lock;
+	struct k_sem free_sem;
+	uint8_t *data;
+	struct net_buf_arena_block *blocks;
+	uint16_t *free_blocks;
+	uint32_t block_size;
+	uint16_t block_count;
+	uint16_t uninit_count;
+	uint16_t free_count;
+	uint16_t current;
+};
+
+#define NET_BUF_ARENA_NO_BLOCK UINT16_MAX
+
+extern const struct net_buf_data_cb net_buf_arena_cb;
+
+/** @endcond */
+
+/**
+ *
+ * @brief Define a new pool for buffers with variable size payloads allocated
+ *        from an arena.
+ *
+ * Same as NET_BUF_POOL_VAR_DEFINE(), but the data payloads are carved
+ * sequentially out of fixed-size blocks instead of coming from a heap. A
+ * block is reused once all payloads allocated from it have been freed, so
+ * the memory can't get fragmented by payloads of different lifetimes, and
+ * allocation is a pointer increment. This suits pools where the payloads
+ * of a packet are allocated and freed together, e.g. RX fragment chains.
+ *
+ * A payload, plus pointer-sized bookkeeping, can't be larger than a block.
+ * Memory is wasted at the end of a block when the next payload doesn't
+ * fit, and by a long-lived payload which keeps its whole block in use.
+ *
+ * @param _name       Name of the pool variable.
+ * @param _count      Number of buffers in the pool.
+ * @param _data_size  Total amount of memory available for data payloads.
+ * @param _block_size Size of the arena blocks, a multiple of the pointer
+ *                    size.
+ * @param _ud_size    User data space to reserve per buffer.
+ * @param _destroy    Optional destroy callback when buffer is freed.
+ */
+#define NET_BUF_POOL_VAR_ARENA_DEFINE(_name, _count, _data_size, _block_size,  \
+				      _ud_size, _destroy)		       \
+	BUILD_ASSERT(((_block_size) % sizeof(void *)) == 0,                    \
+		     "Block size must be a multiple of the pointer size");     \
+	BUILD_ASSERT(((_data_size) / (_block_size)) > 0 &&                     \
+		     ((_data_size) / (_block_size)) < NET_BUF_ARENA_NO_BLOCK,  \
+		     "Unsupported number of arena blocks");                    \
+	_NET_BUF_ARRAY_DEFINE(_name, _count, _ud_size);                        \
+	static uint8_t __noinit __aligned(sizeof(void *))                      \
+		net_buf_arena_data_##_name[(_data_size) / (_block_size) *      \
+					   (_block_size)];                     \
+	static struct net_buf_arena_block                                      \
+		net_buf_arena_blocks_##_name[(_data_size) / (_block_size)];    \
+	static uint16_t                                                        \
+		net_buf_arena_free_##_name[(_data_size) / (_block_size)];      \
+	static struct net_buf_arena net_buf_arena_##_name = {                  \
+		.free_sem = Z_SEM_INITIALIZER(net_buf_arena_##_name.free_sem,  \
+					      (_data_size) / (_block_size),    \
+					      (_data_size) / (_block_size)),   \
+		.data = net_buf_arena_data_##_name,                            \
+		.blocks = net_buf_arena_blocks_##_name,                        \
+		.free_blocks = net_buf_arena_free_##_name,                     \
+		.block_size = (_block_size),                                   \
+		.block_count = (_data_size) / (_block_size),                   \
+		.uninit_count = (_data_size) / (_block_size),                  \
+		.current = NET_BUF_ARENA_NO_BLOCK,                             \
+	};                                                                     \
+	static const struct net_buf_data_alloc net_buf_data_alloc_##_name = {  \
+		.cb = &net_buf_arena_cb,                                       \
+		.alloc_data = &net_buf_arena_##_name,                          \
+		.max_alloc_size = 0,                                           \
+	};                                                                     \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                  \
+		NET_BUF_POOL_INITIALIZER(_name, &net_buf_data_alloc_##_name,   \
+					 _net_buf_##_name, _count, _ud_size,   \
+					 _destroy)
+
 /**
  *
  * @brief Define a new pool for buffers
@@ -1503,6 +1592,33 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate several variable length buffers from a pool at once.
+ *
+ * Take the buffers from the pool with a single lock operation, which is
+ * cheaper than as many calls to net_buf_alloc_len(), e.g. to receive a
+ * packet into a chain of fragments. Either all the buffers are allocated
+ * or none is. They can be linked with net_buf_frag_add() and released at
+ * once with net_buf_unref() on the head of the chain.
+ *
+ * The function never waits. Waiting for the missing buffers while holding
+ * the others could deadlock with another thread doing the same, so if the
+ * pool does not have enough free buffers or data, the buffers taken are
+ * returned to the pool and the call fails. Use net_buf_alloc_len() to wait
+ * for buffers one at a time.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array receiving the allocated buffers.
+ * @param count Number of buffers to allocate.
+ *
+ * @retval 0 All buffers were allocated.
+ * @retval -EINVAL More buffers requested than the pool has.
+ * @retval -ENOMEM Not enough free buffers or data.
+ */
+int __must_check net_buf_alloc_batch(struct net_buf_pool *pool, size_t size,
+				     struct net_buf **bufs, size_t count);
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1565,7 +1681,9 @@ struct net_buf * __must_check net_buf_slist_get(sys_slist_t *list);
 /**
  * @brief Decrements the reference count of a buffer.
  *
- * The buffer is put back into the pool if the reference count reaches zero.
+ * The buffer is put back into the pool if the reference count reaches zero,
+ * and the same is then done for its fragments. Consecutive fragments going
+ * back to the same pool are put back with a single operation.
  *
  * @param buf A valid pointer on a buffer
  */
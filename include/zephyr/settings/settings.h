@@ -274,6 +274,17 @@ int settings_register_with_cprio(struct settings_handler *cf, int cprio);
  */
 int settings_register(struct settings_handler *cf);
 
+/**
+ * Deregister a handler previously registered with @ref settings_register
+ * or @ref settings_register_with_cprio.
+ *
+ * @param cf Structure containing registration info.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if the handler was not registered.
+ */
+int settings_deregister(struct settings_handler *cf);
+
 /**
  * Load serialized items from registered persistence sources. Handlers for
  * serialized item subtrees registered earlier will be called for encountered
@@ -380,6 +391,43 @@ int settings_save_subtree(const char *subtree);
  */
 int settings_save_one(const char *name, const void *value, size_t val_len);
 
+/**
+ * @struct settings_batch_entry
+ * A single key-value pair saved by @ref settings_save_batch.
+ */
+struct settings_batch_entry {
+	/** Name/key of the settings item. */
+	const char *name;
+
+	/** Pointer to the value, NULL deletes the settings item. */
+	const void *value;
+
+	/** Length of the value, 0 deletes the settings item. */
+	size_t val_len;
+};
+
+/**
+ * Write a set of serialized values to persisted storage as one transaction.
+ *
+ * On backends that implement @ref settings_store_itf::csi_save_batch, the
+ * items are committed to storage with a single atomic marker, so after a
+ * power loss either all or none of them are persisted. Other backends save
+ * the items one after the other.
+ *
+ * Items whose value is already stored are not written again. The file
+ * backend rewrites its whole file for a batch, unless no value changed.
+ *
+ * @param entries Items to save, each name may only appear once.
+ * @param count Number of items, at most CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if an entry has no name or a name appears twice.
+ * @retval -E2BIG if there are too many entries.
+ * @retval -ENOENT if there is no storage backend.
+ * @retval -ERRNO other negative error code on storage failure.
+ */
+int settings_save_batch(const struct settings_batch_entry *entries, size_t count);
+
 /**
  * Delete a single serialized in persisted storage.
  *
@@ -548,6 +596,19 @@ struct settings_store_itf {
 	 */
 	int (*csi_save_end)(struct settings_store *cs);
 
+	/**
+	 * @brief Save a set of key-value pairs to storage atomically.
+	 *
+	 * Optional. Either all or none of the entries must be persisted when
+	 * the save is interrupted by a power loss.
+	 *
+	 * @param[in] cs Corresponding backend handler node
+	 * @param[in] entries Key-value pairs, names are unique within the set
+	 * @param[in] count Number of entries
+	 */
+	int (*csi_save_batch)(struct settings_store *cs,
+			      const struct settings_batch_entry *entries, size_t count);
+
 	/**
 	 * @brief Get pointer to the storage instance used by the backend.
 	 *
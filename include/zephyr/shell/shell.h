@@ -912,6 +912,7 @@ struct shell_backend_config_flags {
 	uint32_t mode_delete :1; /*!< Operation mode of backspace key */
 	uint32_t use_colors  :1; /*!< Controls colored syntax */
 	uint32_t use_vt100   :1; /*!< Controls VT100 commands usage in shell */
+	uint32_t machine     :1; /*!< Framed output for automated clients */
 };
 
 BUILD_ASSERT((sizeof(struct shell_backend_config_flags) == sizeof(uint32_t)),
@@ -1030,10 +1031,40 @@ struct shell_ctx {
 	struct k_sem lock_sem;
 	k_tid_t tid;
 	int ret_val;
+
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+	/*!< Type of the frames sent by the shell output functions. */
+	uint8_t machine_frame;
+#endif
 };
 
 extern const struct log_backend_api log_backend_shell_api;
 
+/** Value of the first byte of each frame sent in machine mode. */
+#define SHELL_MACHINE_FRAME_START	0xA5
+
+/** Size of the header of each frame sent in machine mode. */
+#define SHELL_MACHINE_FRAME_HDR_SIZE	4
+
+/**
+ * @brief Types of the frames sent in machine mode.
+ *
+ * Each frame starts with @ref SHELL_MACHINE_FRAME_START, followed by the frame
+ * type, the payload length on 16 bits little endian and the payload.
+ */
+enum shell_machine_frame {
+	/** Text printed by the command. */
+	SHELL_MACHINE_FRAME_OUT = 'o',
+	/** Text printed by the command with shell_error() or shell_warn(). */
+	SHELL_MACHINE_FRAME_ERR = 'e',
+	/** Log messages. */
+	SHELL_MACHINE_FRAME_LOG = 'l',
+	/** Data sent by the command with shell_machine_write(). */
+	SHELL_MACHINE_FRAME_BIN = 'b',
+	/** End of a command, payload is its return value on 32 bits little endian. */
+	SHELL_MACHINE_FRAME_RET = 'r',
+};
+
 /**
  * @brief Flags for setting shell output newline sequence.
  */
@@ -1436,6 +1467,39 @@ int shell_use_vt100_set(const struct shell *sh, bool val);
  */
 int shell_echo_set(const struct shell *sh, bool val);
 
+/**
+ * @brief Allow application to switch the shell to machine mode.
+ *
+ * In machine mode the prompt, echo, colors and VT100 commands are disabled and
+ * all output is sent in frames described by @ref shell_machine_frame. Value is
+ * modified atomically and the previous value is returned.
+ *
+ * @param[in] sh	Pointer to the shell instance.
+ * @param[in] val	Machine mode.
+ *
+ * @return 0 or 1: previous value
+ * @retval -EINVAL if shell is NULL.
+ * @retval -ENOTSUP if @kconfig{CONFIG_SHELL_MACHINE_MODE} is disabled.
+ */
+int shell_machine_mode_set(const struct shell *sh, bool val);
+
+/**
+ * @brief Send binary data in machine mode.
+ *
+ * Data is sent as is in a @ref SHELL_MACHINE_FRAME_BIN frame, after any text
+ * printed before. This can be used to send tables of numbers without
+ * formatting them. Same context restrictions as for shell_fprintf() apply.
+ *
+ * @param[in] sh	Pointer to the shell instance.
+ * @param[in] data	Data to send.
+ * @param[in] len	Data length.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the shell is not in machine mode.
+ * @retval -EBUSY if the shell could not be locked.
+ */
+int shell_machine_write(const struct shell *sh, const void *data, size_t len);
+
 /**
  * @brief Allow application to control whether user input is obscured with
  * asterisks -- useful for implementing passwords.
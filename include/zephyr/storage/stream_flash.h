@@ -25,6 +25,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -75,6 +78,15 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *buf_alt; /* Second buffer, NULL when double buffering is off */
+	uint8_t *wr_buf; /* Buffer being programmed by the work queue */
+	size_t wr_bytes; /* Number of bytes in wr_buf */
+	size_t bytes_queued; /* Number of bytes handed over for writing */
+	int wr_rc; /* Result of the last background write */
+	struct k_work work;
+	struct k_sem wr_idle;
+#endif
 	/** @endcond */
 };
 
@@ -97,6 +109,30 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+#if defined(CONFIG_STREAM_FLASH_DOUBLE_BUFFER) || defined(__DOXYGEN__)
+/**
+ * @brief Enable double buffered writes for a stream flash context.
+ *
+ * Once enabled, a full write buffer is handed over to the stream flash work
+ * queue, which programs it while the caller fills @p buf2, and erases the
+ * pages the next buffer will need ahead of time. Errors of a background write
+ * are reported by the next call to @ref stream_flash_buffered_write. The post
+ * write callback, if any, is invoked from the work queue thread.
+ *
+ * Must be called after @ref stream_flash_init. Double buffering stays enabled
+ * until the context is re-initialized. Re-initializing cancels a background
+ * write that has not started yet and waits for one in progress, the data it
+ * held is dropped. The work item of the context is set up by the first call,
+ * so the context must be zero-initialized before it is first used.
+ *
+ * @param ctx context
+ * @param buf2 Second write buffer, of the length given to @ref stream_flash_init
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_double_buffer_enable(struct stream_flash_ctx *ctx, uint8_t *buf2);
+#endif
+
 /**
  * @brief Read number of bytes written to the flash.
  *
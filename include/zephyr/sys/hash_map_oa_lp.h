@@ -29,6 +29,13 @@ struct sys_hashmap_oa_lp_data {
 	size_t n_buckets;
 	size_t size;
 	size_t n_tombstones;
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	/* Table being moved to buckets, NULL if none */
+	void *old_buckets;
+	size_t old_n_buckets;
+	/* Next bucket of old_buckets to move */
+	size_t rehash_pos;
+#endif
 };
 
 /**
@@ -27,6 +27,19 @@
 extern "C" {
 #endif
 
+struct sys_hashmap_sc_data {
+	void *buckets;
+	size_t n_buckets;
+	size_t size;
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	/* Table being moved to buckets, NULL if none */
+	void *old_buckets;
+	size_t old_n_buckets;
+	/* Next bucket of old_buckets to move */
+	size_t rehash_pos;
+#endif
+};
+
 /**
  * @brief Declare a Separate Chaining Hashmap (advanced)
  *
@@ -42,7 +55,7 @@ extern "C" {
  */
 #define SYS_HASHMAP_SC_DEFINE_ADVANCED(_name, _hash_func, _alloc_func, ...)                        \
 	SYS_HASHMAP_DEFINE_ADVANCED(_name, &sys_hashmap_sc_api, sys_hashmap_config,                \
-				    sys_hashmap_data, _hash_func, _alloc_func, __VA_ARGS__)
+				    sys_hashmap_sc_data, _hash_func, _alloc_func, __VA_ARGS__)
 
 /**
  * @brief Declare a Separate Chaining Hashmap (advanced)
@@ -59,7 +72,7 @@ extern "C" {
  */
 #define SYS_HASHMAP_SC_DEFINE_STATIC_ADVANCED(_name, _hash_func, _alloc_func, ...)                 \
 	SYS_HASHMAP_DEFINE_STATIC_ADVANCED(_name, &sys_hashmap_sc_api, sys_hashmap_config,         \
-					   sys_hashmap_data, _hash_func, _alloc_func, __VA_ARGS__)
+					   sys_hashmap_sc_data, _hash_func, _alloc_func, __VA_ARGS__)
 
 /**
  * @brief Declare a Separate Chaining Hashmap statically
@@ -0,0 +1,393 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_RING_BUFFER_SPSC_H_
+#define ZEPHYR_INCLUDE_SYS_RING_BUFFER_SPSC_H_
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @defgroup ring_buffer_spsc_apis Lock-free SPSC Ring Buffer APIs
+ * @ingroup datastructure_apis
+ *
+ * @brief Lock-free single producer, single consumer byte ring buffer.
+ *
+ * Unlike @ref ring_buffer_apis, this ring buffer may be written by one
+ * execution context and read by another one, e.g. an ISR and a thread or two
+ * threads on different CPUs, without any locking: each side only writes its
+ * own index, publishing it with release semantics, and reads the index of the
+ * other side with acquire semantics. So the data written before
+ * ring_buf_spsc_put_finish() is visible to the consumer once it sees the new
+ * data, and the space released by ring_buf_spsc_get_finish() is only reused
+ * after the consumer is done reading it. On SMP, the two indices are kept in
+ * separate cache lines.
+ *
+ * Claims return up to two areas, the second one being at the start of the
+ * buffer when the claimed data wraps around, so that the whole free space or
+ * the whole data can be claimed at once.
+ *
+ * @warning
+ * The put functions and ring_buf_spsc_space_get() may only be called by the
+ * producer, and the get functions, ring_buf_spsc_size_get() and
+ * ring_buf_spsc_is_empty() by the consumer. Several producers or consumers
+ * must serialize their accesses themselves.
+ *
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+#define RING_BUF_SPSC_MAX_SIZE (UINT32_MAX / 2)
+
+#if defined(CONFIG_SMP) && defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define Z_RING_BUF_SPSC_INDEX_ALIGN __aligned(CONFIG_DCACHE_LINE_SIZE)
+#elif defined(CONFIG_SMP)
+#define Z_RING_BUF_SPSC_INDEX_ALIGN __aligned(64)
+#else
+#define Z_RING_BUF_SPSC_INDEX_ALIGN
+#endif
+
+/** @endcond */
+
+/**
+ * @brief An area of memory, in or out of a ring buffer
+ */
+struct ring_buf_spsc_vec {
+	/** Start of the area */
+	uint8_t *data;
+	/** Length of the area (in bytes) */
+	uint32_t len;
+};
+
+/**
+ * @brief A structure to represent a lock-free SPSC ring buffer
+ */
+struct ring_buf_spsc {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *buffer;
+	uint32_t size;
+	/* Indices run over [0, 2 * size) to tell a full buffer from an empty one */
+	/* Written by the producer only */
+	uint32_t put Z_RING_BUF_SPSC_INDEX_ALIGN;
+	/* Written by the consumer only */
+	uint32_t get Z_RING_BUF_SPSC_INDEX_ALIGN;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+static inline uint32_t z_ring_buf_spsc_load(const uint32_t *idx)
+{
+	return __atomic_load_n(idx, __ATOMIC_ACQUIRE);
+}
+
+static inline void z_ring_buf_spsc_store(uint32_t *idx, uint32_t value)
+{
+	__atomic_store_n(idx, value, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t z_ring_buf_spsc_used(const struct ring_buf_spsc *rb, uint32_t put,
+					    uint32_t get)
+{
+	return (put >= get) ? (put - get) : (put + 2 * rb->size - get);
+}
+
+static inline uint32_t z_ring_buf_spsc_advance(const struct ring_buf_spsc *rb, uint32_t idx,
+					       uint32_t size)
+{
+	return (idx >= 2 * rb->size - size) ? (idx + size - 2 * rb->size) : (idx + size);
+}
+
+static inline uint32_t z_ring_buf_spsc_area(const struct ring_buf_spsc *rb, uint32_t idx,
+					    struct ring_buf_spsc_vec vec[2], uint32_t size)
+{
+	uint32_t offset = (idx >= rb->size) ? (idx - rb->size) : idx;
+
+	vec[0].data = &rb->buffer[offset];
+	vec[0].len = MIN(size, rb->size - offset);
+	vec[1].data = rb->buffer;
+	vec[1].len = size - vec[0].len;
+
+	return size;
+}
+
+/** @endcond */
+
+/**
+ * @brief Statically initialize a lock-free SPSC ring buffer.
+ *
+ * @param buf   Data area of the ring buffer.
+ * @param size8 Size of the data area (in bytes).
+ */
+#define RING_BUF_SPSC_INIT(buf, size8)                                                             \
+	{                                                                                          \
+		.buffer = buf,                                                                     \
+		.size = size8,                                                                     \
+	}
+
+/**
+ * @brief Define and initialize a lock-free SPSC ring buffer.
+ *
+ * @param name  Name of the ring buffer.
+ * @param size8 Size of ring buffer (in bytes).
+ */
+#define RING_BUF_SPSC_DECLARE(name, size8)                                                         \
+	BUILD_ASSERT((size8) > 0 && (size8) <= RING_BUF_SPSC_MAX_SIZE, "Invalid size");            \
+	static uint8_t __noinit _ring_buf_spsc_data_##name[size8];                                 \
+	struct ring_buf_spsc name = RING_BUF_SPSC_INIT(_ring_buf_spsc_data_##name, size8)
+
+/**
+ * @brief Initialize a lock-free SPSC ring buffer.
+ *
+ * @param rb   Address of ring buffer.
+ * @param size Ring buffer size (in bytes).
+ * @param data Ring buffer data area (uint8_t data[size]).
+ */
+static inline void ring_buf_spsc_init(struct ring_buf_spsc *rb, uint32_t size, uint8_t *data)
+{
+	__ASSERT(size > 0 && size <= RING_BUF_SPSC_MAX_SIZE, "Invalid size");
+
+	rb->buffer = data;
+	rb->size = size;
+	rb->put = 0;
+	rb->get = 0;
+}
+
+/**
+ * @brief Empty a lock-free SPSC ring buffer.
+ *
+ * @warning
+ * Neither the producer nor the consumer may access the ring buffer meanwhile.
+ *
+ * @param rb Address of ring buffer.
+ */
+static inline void ring_buf_spsc_reset(struct ring_buf_spsc *rb)
+{
+	z_ring_buf_spsc_store(&rb->put, 0);
+	z_ring_buf_spsc_store(&rb->get, 0);
+}
+
+/**
+ * @brief Return ring buffer capacity.
+ *
+ * @param rb Address of ring buffer.
+ *
+ * @return Ring buffer capacity (in bytes).
+ */
+static inline uint32_t ring_buf_spsc_capacity_get(const struct ring_buf_spsc *rb)
+{
+	return rb->size;
+}
+
+/**
+ * @brief Determine free space in a ring buffer, from the producer.
+ *
+ * @param rb Address of ring buffer.
+ *
+ * @return Ring buffer free space (in bytes), which can only grow until the
+ *	   producer writes to the ring buffer.
+ */
+static inline uint32_t ring_buf_spsc_space_get(const struct ring_buf_spsc *rb)
+{
+	return rb->size - z_ring_buf_spsc_used(rb, rb->put, z_ring_buf_spsc_load(&rb->get));
+}
+
+/**
+ * @brief Determine size of available data in a ring buffer, from the consumer.
+ *
+ * @param rb Address of ring buffer.
+ *
+ * @return Ring buffer data size (in bytes), which can only grow until the
+ *	   consumer reads from the ring buffer.
+ */
+static inline uint32_t ring_buf_spsc_size_get(const struct ring_buf_spsc *rb)
+{
+	return z_ring_buf_spsc_used(rb, z_ring_buf_spsc_load(&rb->put), rb->get);
+}
+
+/**
+ * @brief Determine if a ring buffer is empty, from the consumer.
+ *
+ * @param rb Address of ring buffer.
+ *
+ * @return true if the ring buffer is empty, or false if not.
+ */
+static inline bool ring_buf_spsc_is_empty(const struct ring_buf_spsc *rb)
+{
+	return z_ring_buf_spsc_load(&rb->put) == rb->get;
+}
+
+/**
+ * @brief Claim free space of a ring buffer for writing.
+ *
+ * The claimed space is written in place, then committed with
+ * @ref ring_buf_spsc_put_finish. It is made of up to two areas, the second
+ * one being empty unless the space wraps around the end of the buffer.
+ *
+ * @param[in]  rb   Address of ring buffer.
+ * @param[out] vec  Claimed areas.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Total size of the claimed areas, which can be smaller than
+ *	   requested if there is not enough free space.
+ */
+static inline uint32_t ring_buf_spsc_put_claim(struct ring_buf_spsc *rb,
+					       struct ring_buf_spsc_vec vec[2], uint32_t size)
+{
+	return z_ring_buf_spsc_area(rb, rb->put, vec, MIN(size, ring_buf_spsc_space_get(rb)));
+}
+
+/**
+ * @brief Commit data written to claimed space.
+ *
+ * The committed data is the first @p size bytes of the space claimed by
+ * the last @ref ring_buf_spsc_put_claim, and becomes visible to the consumer.
+ *
+ * @param rb   Address of ring buffer.
+ * @param size Number of bytes written.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @p size exceeds free space in the ring buffer.
+ */
+static inline int ring_buf_spsc_put_finish(struct ring_buf_spsc *rb, uint32_t size)
+{
+	if (size > ring_buf_spsc_space_get(rb)) {
+		return -EINVAL;
+	}
+
+	z_ring_buf_spsc_store(&rb->put, z_ring_buf_spsc_advance(rb, rb->put, size));
+
+	return 0;
+}
+
+/**
+ * @brief Claim data of a ring buffer for reading.
+ *
+ * The claimed data is read in place, then released with
+ * @ref ring_buf_spsc_get_finish. It is made of up to two areas, the second
+ * one being empty unless the data wraps around the end of the buffer.
+ *
+ * @param[in]  rb   Address of ring buffer.
+ * @param[out] vec  Claimed areas.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Total size of the claimed areas, which can be smaller than
+ *	   requested if there is not enough data.
+ */
+static inline uint32_t ring_buf_spsc_get_claim(struct ring_buf_spsc *rb,
+					       struct ring_buf_spsc_vec vec[2], uint32_t size)
+{
+	return z_ring_buf_spsc_area(rb, rb->get, vec, MIN(size, ring_buf_spsc_size_get(rb)));
+}
+
+/**
+ * @brief Release data read from claimed areas.
+ *
+ * The released data is the first @p size bytes of the data claimed by the
+ * last @ref ring_buf_spsc_get_claim, and its space becomes available to the
+ * producer.
+ *
+ * @param rb   Address of ring buffer.
+ * @param size Number of bytes read.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @p size exceeds valid bytes in the ring buffer.
+ */
+static inline int ring_buf_spsc_get_finish(struct ring_buf_spsc *rb, uint32_t size)
+{
+	if (size > ring_buf_spsc_size_get(rb)) {
+		return -EINVAL;
+	}
+
+	z_ring_buf_spsc_store(&rb->get, z_ring_buf_spsc_advance(rb, rb->get, size));
+
+	return 0;
+}
+
+/**
+ * @brief Write (copy) data gathered from several areas to a ring buffer.
+ *
+ * Like writev(), the areas are written in order, and as much data as fits
+ * is written.
+ *
+ * @param rb      Address of ring buffer.
+ * @param vec     Areas to write.
+ * @param vec_cnt Number of areas.
+ *
+ * @return Number of bytes written.
+ */
+uint32_t ring_buf_spsc_putv(struct ring_buf_spsc *rb, const struct ring_buf_spsc_vec *vec,
+			    size_t vec_cnt);
+
+/**
+ * @brief Read (copy) data from a ring buffer, scattering it to several areas.
+ *
+ * Like readv(), the areas are filled in order, with as much data as
+ * available.
+ *
+ * @param rb      Address of ring buffer.
+ * @param vec     Areas to fill. An area with a NULL address discards its data.
+ * @param vec_cnt Number of areas.
+ *
+ * @return Number of bytes read.
+ */
+uint32_t ring_buf_spsc_getv(struct ring_buf_spsc *rb, const struct ring_buf_spsc_vec *vec,
+			    size_t vec_cnt);
+
+/**
+ * @brief Write (copy) data to a ring buffer.
+ *
+ * @param rb   Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes written.
+ */
+static inline uint32_t ring_buf_spsc_put(struct ring_buf_spsc *rb, const uint8_t *data,
+					 uint32_t size)
+{
+	const struct ring_buf_spsc_vec vec = {.data = (uint8_t *)data, .len = size};
+
+	return ring_buf_spsc_putv(rb, &vec, 1);
+}
+
+/**
+ * @brief Read (copy) data from a ring buffer.
+ *
+ * @param rb   Address of ring buffer.
+ * @param data Address of the output buffer. Can be NULL to discard data.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes read.
+ */
+static inline uint32_t ring_buf_spsc_get(struct ring_buf_spsc *rb, uint8_t *data, uint32_t size)
+{
+	const struct ring_buf_spsc_vec vec = {.data = data, .len = size};
+
+	return ring_buf_spsc_getv(rb, &vec, 1);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_RING_BUFFER_SPSC_H_ */
@@ -46,6 +46,14 @@ struct zbus_channel_data {
 	 */
 	struct k_sem sem;
 
+#if defined(CONFIG_ZBUS_CHANNEL_ID) || defined(__DOXYGEN__)
+	/** Channels sorted by ID. Index, considering the ITERABLE SECTIONS allocation order, of
+	 * the channel whose ID ranks where this channel is allocated. Set at initialization to
+	 * look channels up by ID with a binary search.
+	 */
+	uint16_t id_order;
+#endif /* CONFIG_ZBUS_CHANNEL_ID */
+
 #if defined(CONFIG_ZBUS_PRIORITY_BOOST)
 	/** Highest observer priority. Indicates the priority that the VDED will use to boost the
 	 * notification process avoiding preemptions.
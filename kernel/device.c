@@ -20,7 +20,15 @@ int do_device_init(const struct device *dev)
 	int rc = 0;
 
 	if (dev->ops.init != NULL) {
+#ifdef CONFIG_DEVICE_INIT_TIME
+		uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_DEVICE_INIT_TIME */
+
 		rc = dev->ops.init(dev);
+
+#ifdef CONFIG_DEVICE_INIT_TIME
+		dev->state->init_cycles = k_cycle_get_32() - start;
+#endif /* CONFIG_DEVICE_INIT_TIME */
 		/* If initialization failed, record in dev->state->init_res
 		 * the POSITIVE value of the resulting errno
 		 */
@@ -79,6 +87,59 @@ static inline int z_vrfy_device_init(const struct device *dev)
 #include <zephyr/syscalls/device_init_mrsh.c>
 #endif
 
+#ifdef CONFIG_DEVICE_INIT_TIME
+uint32_t device_init_time_get(const struct device *dev)
+{
+	return k_cyc_to_us_floor32(dev->state->init_cycles);
+}
+#endif /* CONFIG_DEVICE_INIT_TIME */
+
+
+#ifdef CONFIG_DEVICE_NAME_HASH
+/*
+ * Perfect hash of the names of the devicetree devices, generated by
+ * gen_defines.py. Nodes may have no device, so they are referenced weakly
+ * and the slots of the missing ones are NULL.
+ */
+#define DEVICE_NAME_HASH_DECLARE(node_id, slot)                                                    \
+	extern IF_DISABLED(Z_DEVICE_IS_MUTABLE(node_id), (const))                                  \
+		struct device DEVICE_DT_NAME_GET(node_id) __weak;
+
+#define DEVICE_NAME_HASH_SLOT(node_id, slot) [slot] = &DEVICE_DT_NAME_GET(node_id),
+
+DT_FOREACH_DEVICE_NAME_HASH_SLOT(DEVICE_NAME_HASH_DECLARE)
+
+static const uint8_t device_name_seeds[DT_DEVICE_NAME_HASH_SIZE] = DT_DEVICE_NAME_HASH_SEEDS;
+
+static const struct device *const device_name_slots[DT_DEVICE_NAME_HASH_SIZE] = {
+	DT_FOREACH_DEVICE_NAME_HASH_SLOT(DEVICE_NAME_HASH_SLOT)
+};
+
+/* Must match device_name_hash() in gen_defines.py */
+static uint32_t device_name_hash(const char *name, uint32_t seed)
+{
+	uint32_t h = 0x811c9dc5U ^ seed;
+
+	for (; *name != '\0'; name++) {
+		h = (h ^ (uint8_t)*name) * 0x01000193U;
+	}
+
+	return h ^ (h >> 16);
+}
+
+static const struct device *device_name_lookup(const char *name)
+{
+	uint32_t seed = device_name_seeds[device_name_hash(name, 0) % DT_DEVICE_NAME_HASH_SIZE];
+	const struct device *dev =
+		device_name_slots[device_name_hash(name, seed) % DT_DEVICE_NAME_HASH_SIZE];
+
+	if ((dev != NULL) && (strcmp(name, dev->name) == 0)) {
+		return dev;
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_NAME_HASH */
 
 const struct device *z_impl_device_get_binding(const char *name)
 {
@@ -89,6 +150,14 @@ const struct device *z_impl_device_get_binding(const char *name)
 		return NULL;
 	}
 
+#ifdef CONFIG_DEVICE_NAME_HASH
+	const struct device *found = device_name_lookup(name);
+
+	if (found != NULL) {
+		return z_impl_device_is_ready(found) ? found : NULL;
+	}
+#endif /* CONFIG_DEVICE_NAME_HASH */
+
 	/* Return NULL if the device matching 'name' is not ready. */
 	STRUCT_SECTION_FOREACH(device, dev) {
 		if ((dev->name == name) || (strcmp(name, dev->name) == 0)) {
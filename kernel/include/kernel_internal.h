@@ -182,6 +182,18 @@ void z_mem_manage_init(void);
  */
 void z_mem_manage_boot_finish(void);
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/**
+ * @brief Run the init entries of a level, initializing devices in parallel
+ *
+ * @param start First init entry of the level
+ * @param end End of the init entries of the level
+ * @param level Init level, for tracing
+ */
+void z_device_init_parallel_run(const struct init_entry *start, const struct init_entry *end,
+				int level);
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 
 bool z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
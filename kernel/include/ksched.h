@@ -328,6 +328,43 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+/**
+ * @brief Start accounting a ready wait or a block for a thread leaving the CPU
+ *
+ * Must be called before the thread is switched out, while its state
+ * tells whether it is still ready or blocked.
+ */
+void z_sched_usage_wait_out(struct k_thread *thread);
+
+/**
+ * @brief Stop accounting the ready wait of a thread getting the CPU
+ */
+void z_sched_usage_wait_in(struct k_thread *thread);
+
+/**
+ * @brief Stop accounting the block of a thread and start its ready wait
+ *
+ * Called when the thread is added to the run queue.
+ */
+void z_sched_usage_wait_ready(struct k_thread *thread);
+#else
+static inline void z_sched_usage_wait_out(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_usage_wait_in(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_usage_wait_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
@@ -337,6 +374,17 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
 
+#ifdef CONFIG_METRICS_KERNEL
+/**
+ * @brief Update context switch metrics, called when switching threads
+ */
+void z_sched_metrics_switch(void);
+#else
+static inline void z_sched_metrics_switch(void)
+{
+}
+#endif /* CONFIG_METRICS_KERNEL */
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,12 @@ extern void z_check_stack_sentinel(void);
 #define z_check_stack_sentinel() /**/
 #endif /* CONFIG_STACK_SENTINEL */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+extern void z_thread_stack_watermark_sample(void);
+#else
+#define z_thread_stack_watermark_sample() /**/
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 extern struct k_spinlock _sched_spinlock;
 
 /* In SMP, the irq_lock() is a spinlock which is implicitly released
@@ -104,6 +110,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	old_thread = _current;
 
 	z_check_stack_sentinel();
+	z_thread_stack_watermark_sample();
 
 	old_thread->swap_retval = -EAGAIN;
 
@@ -122,6 +129,9 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
+		z_sched_metrics_switch();
+		z_sched_usage_wait_out(old_thread);
+		z_sched_usage_wait_in(new_thread);
 
 #ifdef CONFIG_SMP
 		new_thread->base.cpu = arch_curr_cpu()->id;
@@ -203,6 +213,7 @@ static inline int z_swap_irqlock(unsigned int key)
 {
 	int ret;
 	z_check_stack_sentinel();
+	z_thread_stack_watermark_sample();
 
 #ifdef CONFIG_SPIN_VALIDATE
 	/* Refer to comment in do_swap() above for details */
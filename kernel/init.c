@@ -233,6 +233,13 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if ((level == INIT_LEVEL_POST_KERNEL) || (level == INIT_LEVEL_APPLICATION)) {
+		z_device_init_parallel_run(levels[level], levels[level + 1], level);
+		return;
+	}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
 		int result = 0;
@@ -0,0 +1,199 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Parallel initialization of the devices of an init level.
+ *
+ * Init entries are handed out in link order to the main thread and to a
+ * pool of helper threads. Before initializing a device, a thread waits for
+ * the devices it requires which were handed out before it, so waits always
+ * go backwards in link order and cannot deadlock. SYS_INIT() entries carry
+ * no dependency information, so they act as barriers: they run once all the
+ * entries before them are done, and no entry after them is handed out before
+ * they return.
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/tracing/tracing.h>
+#include <kernel_internal.h>
+
+/* defined in device.c */
+extern int do_device_init(const struct device *dev);
+
+#define NUM_HELPERS CONFIG_DEVICE_INIT_PARALLEL_THREADS
+
+static K_KERNEL_STACK_ARRAY_DEFINE(helper_stacks, NUM_HELPERS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread helper_threads[NUM_HELPERS];
+
+static struct {
+	struct k_mutex lock;
+	struct k_condvar cond;
+	/* Entries of the level */
+	const struct init_entry *start;
+	const struct init_entry *end;
+	/* Next entry to hand out */
+	const struct init_entry *next;
+	/* Entries before this one may be handed out */
+	const struct init_entry *limit;
+	/* Number of entries handed out and not done yet */
+	unsigned int running;
+	int level;
+	bool stop;
+} pi;
+
+/* Called with pi.lock held */
+static bool dep_pending(const struct device *dep)
+{
+	if ((dep->state->initialized) || ((dep->flags & DEVICE_FLAG_INIT_DEFERRED) != 0U)) {
+		return false;
+	}
+
+	for (const struct init_entry *entry = pi.start; entry < pi.next; entry++) {
+		if (entry->dev == dep) {
+			return true;
+		}
+	}
+
+	/* In another level or later in this one, as with serial init */
+	return false;
+}
+
+/* Called with pi.lock held */
+static void deps_wait(const struct device *dev)
+{
+	const device_handle_t *handles;
+	size_t count = 0;
+
+	handles = device_required_handles_get(dev, &count);
+
+	for (size_t i = 0; i < count; i++) {
+		const struct device *dep = device_from_handle(handles[i]);
+
+		while ((dep != NULL) && dep_pending(dep)) {
+			(void)k_condvar_wait(&pi.cond, &pi.lock, K_FOREVER);
+		}
+	}
+}
+
+/* Hand out and run one device entry, called with pi.lock held */
+static bool device_entry_run(void)
+{
+	const struct init_entry *entry;
+	const struct device *dev;
+	int result = 0;
+
+	if (pi.next == pi.limit) {
+		return false;
+	}
+
+	entry = pi.next++;
+	dev = entry->dev;
+	pi.running++;
+
+	deps_wait(dev);
+	k_mutex_unlock(&pi.lock);
+
+	sys_trace_sys_init_enter(entry, pi.level);
+	if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
+		result = do_device_init(dev);
+	}
+	sys_trace_sys_init_exit(entry, pi.level, result);
+
+	(void)k_mutex_lock(&pi.lock, K_FOREVER);
+	pi.running--;
+	(void)k_condvar_broadcast(&pi.cond);
+
+	return true;
+}
+
+static void helper_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	(void)k_mutex_lock(&pi.lock, K_FOREVER);
+
+	while (!pi.stop) {
+		if (!device_entry_run()) {
+			(void)k_condvar_wait(&pi.cond, &pi.lock, K_FOREVER);
+		}
+	}
+
+	k_mutex_unlock(&pi.lock);
+}
+
+void z_device_init_parallel_run(const struct init_entry *start, const struct init_entry *end,
+				int level)
+{
+	k_mutex_init(&pi.lock);
+	k_condvar_init(&pi.cond);
+	pi.start = start;
+	pi.end = end;
+	pi.next = start;
+	pi.limit = start;
+	pi.running = 0;
+	pi.level = level;
+	pi.stop = false;
+
+	for (int i = 0; i < NUM_HELPERS; i++) {
+		k_thread_create(&helper_threads[i], helper_stacks[i],
+				K_KERNEL_STACK_SIZEOF(helper_stacks[i]), helper_entry,
+				NULL, NULL, NULL, CONFIG_MAIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&helper_threads[i], "device_init");
+	}
+
+	(void)k_mutex_lock(&pi.lock, K_FOREVER);
+
+	while (true) {
+		const struct init_entry *entry;
+		int result;
+
+		/* Hand out the devices up to the next SYS_INIT() */
+		while ((pi.limit < pi.end) && (pi.limit->dev != NULL)) {
+			pi.limit++;
+		}
+		(void)k_condvar_broadcast(&pi.cond);
+
+		/* Help with them, then wait for the last ones to be done */
+		while (true) {
+			if (device_entry_run()) {
+				continue;
+			}
+
+			if (pi.running == 0) {
+				break;
+			}
+
+			(void)k_condvar_wait(&pi.cond, &pi.lock, K_FOREVER);
+		}
+
+		if (pi.next == pi.end) {
+			break;
+		}
+
+		entry = pi.next++;
+		pi.limit = pi.next;
+		k_mutex_unlock(&pi.lock);
+
+		sys_trace_sys_init_enter(entry, level);
+		result = entry->init_fn();
+		sys_trace_sys_init_exit(entry, level, result);
+
+		(void)k_mutex_lock(&pi.lock, K_FOREVER);
+	}
+
+	pi.stop = true;
+	(void)k_condvar_broadcast(&pi.cond);
+	k_mutex_unlock(&pi.lock);
+
+	for (int i = 0; i < NUM_HELPERS; i++) {
+		(void)k_thread_join(&helper_threads[i], K_FOREVER);
+	}
+}
@@ -22,6 +22,10 @@
 #include <zephyr/timing/timing.h>
 #include <zephyr/sys/util.h>
 
+#ifdef CONFIG_METRICS_KERNEL
+#include <zephyr/metrics/metrics.h>
+#endif
+
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 #if defined(CONFIG_SWAP_NONATOMIC) && defined(CONFIG_TIMESLICING)
@@ -357,6 +361,7 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		z_sched_usage_wait_ready(thread);
 		queue_thread(thread);
 		update_cache(0);
 
@@ -869,6 +874,24 @@ struct k_thread *z_swap_next_thread(void)
 #endif /* CONFIG_SMP */
 }
 
+#ifdef CONFIG_METRICS_KERNEL
+METRICS_COUNTER_DEFINE(kernel_context_switches, "Number of context switches");
+METRICS_HISTOGRAM_DEFINE(kernel_thread_run_cycles,
+			 "Cycles a thread ran before being switched out");
+
+static uint32_t metrics_switch_cycles[CONFIG_MP_MAX_NUM_CPUS];
+
+void z_sched_metrics_switch(void)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t *last = &metrics_switch_cycles[METRICS_CPU_ID()];
+
+	metrics_counter_inc(&kernel_context_switches);
+	metrics_histogram_observe(&kernel_thread_run_cycles, now - *last);
+	*last = now;
+}
+#endif /* CONFIG_METRICS_KERNEL */
+
 #ifdef CONFIG_USE_SWITCH
 /* Just a wrapper around z_current_thread_set(xxx) with tracing */
 static inline void set_current(struct k_thread *new_thread)
@@ -933,6 +956,9 @@ void *z_get_next_switch_handle(void *interrupted)
 		if (old_thread != new_thread) {
 			uint8_t  cpu_id;
 
+			z_sched_metrics_switch();
+			z_sched_usage_wait_out(old_thread);
+			z_sched_usage_wait_in(new_thread);
 			z_sched_switch_spin(new_thread);
 			arch_cohere_stacks(old_thread, interrupted, new_thread);
 
@@ -979,6 +1005,11 @@ void *z_get_next_switch_handle(void *interrupted)
 	return ret;
 #else
 	z_sched_usage_switch(_kernel.ready_q.cache);
+	if (_kernel.ready_q.cache != _current) {
+		z_sched_metrics_switch();
+		z_sched_usage_wait_out(_current);
+		z_sched_usage_wait_in(_kernel.ready_q.cache);
+	}
 	_current->switch_handle = interrupted;
 	set_current(_kernel.ready_q.cache);
 	return _current->switch_handle;
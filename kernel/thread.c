@@ -347,6 +347,57 @@ void z_check_stack_sentinel(void)
 }
 #endif /* CONFIG_STACK_SENTINEL */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* Record how deep the current thread's stack is, called right before it gets
+ * switched out. Samples taken while running on another stack (interrupt
+ * stack, privileged stack of a user thread, host stack on POSIX
+ * architectures) are out of the stack buffer and ignored.
+ */
+void z_thread_stack_watermark_sample(void)
+{
+	struct k_thread *thread = _current;
+	uintptr_t sp = (uintptr_t)__builtin_frame_address(0);
+	uintptr_t start = thread->stack_info.start;
+	size_t used;
+
+	if ((sp < start) || (sp >= (start + thread->stack_info.size))) {
+		return;
+	}
+
+#ifdef CONFIG_STACK_GROWS_UP
+	used = sp - start;
+#else
+	used = start + thread->stack_info.size - sp;
+#endif /* CONFIG_STACK_GROWS_UP */
+
+	if (used > thread->stack_info.watermark) {
+		thread->stack_info.watermark = used;
+	}
+}
+
+int k_thread_stack_watermark_get(const struct k_thread *thread, size_t *used_ptr)
+{
+#ifdef CONFIG_THREAD_STACK_MEM_MAPPED
+	if (thread->stack_info.mapped.addr == NULL) {
+		return -EINVAL;
+	}
+#endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
+
+	if (thread == _current) {
+		z_thread_stack_watermark_sample();
+	}
+
+	*used_ptr = thread->stack_info.watermark;
+
+	return 0;
+}
+
+void k_thread_stack_watermark_reset(struct k_thread *thread)
+{
+	thread->stack_info.watermark = 0;
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #if defined(CONFIG_STACK_POINTER_RANDOM) && (CONFIG_STACK_POINTER_RANDOM != 0)
 int z_stack_adjust_initialized;
 
@@ -495,6 +546,9 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	new_thread->stack_info.watermark = 0;
+#endif
 
 #ifdef CONFIG_THREAD_RUNTIME_STACK_SAFETY
 	new_thread->stack_info.usage.unused_threshold =
@@ -1133,6 +1187,11 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif /* CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+#if !defined(CONFIG_USE_SWITCH)
+	z_sched_metrics_switch();
+	z_sched_usage_wait_in(_current);
+#endif /* !CONFIG_USE_SWITCH */
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif /* CONFIG_TRACING */
@@ -1142,6 +1201,7 @@ void z_thread_mark_switched_out(void)
 {
 #if defined(CONFIG_SCHED_THREAD_USAGE) && !defined(CONFIG_USE_SWITCH)
 	z_sched_usage_stop();
+	z_sched_usage_wait_out(_current);
 #endif /*CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
 #ifdef CONFIG_TRACING
@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,6 +72,150 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+#define WAIT_HIST_BUCKETS CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS
+
+#if WAIT_HIST_BUCKETS > 0
+static void wait_hist_add(uint32_t *hist, uint32_t cycles)
+{
+	uint32_t idx = (cycles == 0U) ? 0U : 32U - u32_count_leading_zeros(cycles);
+
+	idx = (idx > CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_SHIFT) ?
+	      idx - CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_SHIFT : 0U;
+
+	hist[MIN(idx, WAIT_HIST_BUCKETS - 1U)]++;
+}
+#endif /* WAIT_HIST_BUCKETS > 0 */
+
+static void sched_thread_update_ready_wait(struct k_thread *thread, uint32_t now)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t cycles = now - usage->ready0;
+
+	usage->ready0 = 0;
+	usage->ready_wait += cycles;
+	usage->num_ready_waits++;
+	usage->longest_ready_wait = MAX(usage->longest_ready_wait, cycles);
+#if WAIT_HIST_BUCKETS > 0
+	wait_hist_add(usage->ready_wait_hist, cycles);
+#endif
+}
+
+static void sched_thread_update_blocked(struct k_thread *thread, uint32_t now)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t cycles = now - usage->blocked0;
+
+	usage->blocked0 = 0;
+	usage->blocked += cycles;
+	usage->num_blocks++;
+	usage->longest_blocked = MAX(usage->longest_blocked, cycles);
+#if WAIT_HIST_BUCKETS > 0
+	wait_hist_add(usage->blocked_hist, cycles);
+#endif
+}
+
+void z_sched_usage_wait_out(struct k_thread *thread)
+{
+	k_spinlock_key_t  key;
+	uint32_t now;
+
+	if ((thread == NULL) || !thread->base.usage.track_usage || is_thread_dummy(thread)) {
+		return;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	now = usage_now();
+
+	/* A thread still ready was preempted or yielded */
+	if (z_is_thread_ready(thread)) {
+		thread->base.usage.ready0 = now;
+		thread->base.usage.blocked0 = 0;
+	} else {
+		thread->base.usage.blocked0 = now;
+		thread->base.usage.ready0 = 0;
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+void z_sched_usage_wait_in(struct k_thread *thread)
+{
+	k_spinlock_key_t  key;
+
+	if ((thread == NULL) || (thread->base.usage.ready0 == 0U)) {
+		return;
+	}
+
+	key = k_spin_lock(&usage_lock);
+
+	if (thread->base.usage.ready0 != 0U) {
+		sched_thread_update_ready_wait(thread, usage_now());
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+void z_sched_usage_wait_ready(struct k_thread *thread)
+{
+	k_spinlock_key_t  key;
+	uint32_t now;
+
+	if (!thread->base.usage.track_usage) {
+		return;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	now = usage_now();
+
+	if (thread->base.usage.blocked0 != 0U) {
+		sched_thread_update_blocked(thread, now);
+	}
+
+	if (thread->base.usage.ready0 == 0U) {
+		thread->base.usage.ready0 = now;
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+/* Copy-out the wait stats, including the wait in progress if any */
+static void sched_thread_wait_usage(struct k_thread *thread,
+				    struct k_thread_runtime_stats *stats)
+{
+	struct k_cycle_stats *usage = &thread->base.usage;
+	uint32_t now = usage_now();
+
+	stats->ready_wait_cycles      = usage->ready_wait;
+	stats->peak_ready_wait_cycles = usage->longest_ready_wait;
+	stats->num_ready_waits        = usage->num_ready_waits;
+	stats->blocked_cycles         = usage->blocked;
+	stats->peak_blocked_cycles    = usage->longest_blocked;
+	stats->num_blocks             = usage->num_blocks;
+
+	if (usage->ready0 != 0U) {
+		uint32_t cycles = now - usage->ready0;
+
+		stats->ready_wait_cycles += cycles;
+		stats->peak_ready_wait_cycles = MAX(stats->peak_ready_wait_cycles, cycles);
+	}
+
+	if (usage->blocked0 != 0U) {
+		uint32_t cycles = now - usage->blocked0;
+
+		stats->blocked_cycles += cycles;
+		stats->peak_blocked_cycles = MAX(stats->peak_blocked_cycles, cycles);
+	}
+
+#if WAIT_HIST_BUCKETS > 0
+	memcpy(stats->ready_wait_histogram, usage->ready_wait_hist,
+	       sizeof(stats->ready_wait_histogram));
+	memcpy(stats->blocked_histogram, usage->blocked_hist,
+	       sizeof(stats->blocked_histogram));
+#endif
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -165,6 +310,19 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+	stats->ready_wait_cycles = 0;
+	stats->peak_ready_wait_cycles = 0;
+	stats->blocked_cycles = 0;
+	stats->peak_blocked_cycles = 0;
+	stats->num_ready_waits = 0;
+	stats->num_blocks = 0;
+#if WAIT_HIST_BUCKETS > 0
+	memset(stats->ready_wait_histogram, 0, sizeof(stats->ready_wait_histogram));
+	memset(stats->blocked_histogram, 0, sizeof(stats->blocked_histogram));
+#endif
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -220,6 +378,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+	sched_thread_wait_usage(thread, stats);
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -365,6 +527,23 @@ int z_thread_stats_query(struct k_obj_core *obj_core, void *stats)
 	return 0;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+/* A wait in progress is kept, and accounted once it ends */
+static void sched_thread_wait_reset(struct k_cycle_stats *usage)
+{
+	usage->ready_wait = 0ULL;
+	usage->longest_ready_wait = 0ULL;
+	usage->blocked = 0ULL;
+	usage->longest_blocked = 0ULL;
+	usage->num_ready_waits = 0U;
+	usage->num_blocks = 0U;
+#if WAIT_HIST_BUCKETS > 0
+	memset(usage->ready_wait_hist, 0, sizeof(usage->ready_wait_hist));
+	memset(usage->blocked_hist, 0, sizeof(usage->blocked_hist));
+#endif
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 int z_thread_stats_reset(struct k_obj_core *obj_core)
 {
 	k_spinlock_key_t  key;
@@ -381,6 +560,9 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+	sched_thread_wait_reset(stats);
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
 
 	if (thread != _current_cpu->current) {
 
@@ -169,6 +169,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	sys_snode_t dobj_hash;
 
 	/* The object itself */
 	void *data;
@@ -185,8 +186,45 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Hash table of allocated kernel objects, keyed by object address, for
+ * k_object_find(). Each bucket has its own lock so lookups, done on every
+ * system call taking a dynamic object, neither walk all the objects nor
+ * contend on a global lock.
  */
+#define OBJ_HASH_BITS CONFIG_DYNAMIC_OBJECTS_HASH_BITS
+
+struct obj_hash_bucket {
+	struct k_spinlock lock;
+	sys_slist_t list;
+};
+
+static struct obj_hash_bucket obj_hash[BIT(OBJ_HASH_BITS)];
+
+static struct obj_hash_bucket *obj_hash_bucket_get(const void *obj)
+{
+	/* Fibonacci hashing, the low bits of an address are mostly zero */
+	uint32_t h = (uint32_t)POINTER_TO_UINT(obj) * 2654435761U;
+
+	return &obj_hash[((uint64_t)h << OBJ_HASH_BITS) >> 32];
+}
+
+static void dyn_object_hash_add(struct dyn_obj *dyn)
+{
+	struct obj_hash_bucket *bucket = obj_hash_bucket_get(dyn->kobj.name);
+	k_spinlock_key_t key = k_spin_lock(&bucket->lock);
+
+	sys_slist_prepend(&bucket->list, &dyn->dobj_hash);
+	k_spin_unlock(&bucket->lock, key);
+}
+
+static void dyn_object_hash_remove(struct dyn_obj *dyn)
+{
+	struct obj_hash_bucket *bucket = obj_hash_bucket_get(dyn->kobj.name);
+	k_spinlock_key_t key = k_spin_lock(&bucket->lock);
+
+	(void)sys_slist_find_and_remove(&bucket->list, &dyn->dobj_hash);
+	k_spin_unlock(&bucket->lock, key);
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -224,17 +262,13 @@ static size_t obj_align_get(enum k_objects otype)
 
 static struct dyn_obj *dyn_object_find(const void *obj)
 {
+	struct obj_hash_bucket *bucket = obj_hash_bucket_get(obj);
 	struct dyn_obj *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	key = k_spin_lock(&lists_lock);
+	key = k_spin_lock(&bucket->lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&bucket->list, node, dobj_hash) {
 		if (node->kobj.name == obj) {
 			goto end;
 		}
@@ -244,7 +278,7 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 	node = NULL;
 
  end:
-	k_spin_unlock(&lists_lock, key);
+	k_spin_unlock(&bucket->lock, key);
 
 	return node;
 }
@@ -376,6 +410,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	dyn_object_hash_add(dyn);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -469,6 +504,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
+		dyn_object_hash_remove(dyn);
 		sys_dlist_remove(&dyn->dobj_list);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
@@ -601,6 +637,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
+	dyn_object_hash_remove(dyn);
 	sys_dlist_remove(&dyn->dobj_list);
 	k_free(dyn->data);
 	k_free(dyn);
@@ -34,13 +34,12 @@ BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, n_buckets) ==
 BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, size) ==
 	     offsetof(struct sys_hashmap_data, size));
 
-static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
-						 bool used_ok, bool unused_ok, bool tombstone_ok)
+static struct oalp_entry *sys_hashmap_oa_lp_find_in(struct oalp_entry *const buckets,
+						    const size_t n_buckets, uint32_t hash,
+						    uint64_t key, bool used_ok, bool unused_ok,
+						    bool tombstone_ok)
 {
 	struct oalp_entry *entry = NULL;
-	const size_t n_buckets = map->data->n_buckets;
-	uint32_t hash = map->hash_func(&key, sizeof(key));
-	struct oalp_entry *const buckets = map->data->buckets;
 
 	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
 		j &= (n_buckets - 1);
@@ -73,6 +72,42 @@ static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map,
 	return NULL;
 }
 
+static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
+						 bool used_ok, bool unused_ok, bool tombstone_ok)
+{
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	return sys_hashmap_oa_lp_find_in(map->data->buckets, map->data->n_buckets, hash, key,
+					 used_ok, unused_ok, tombstone_ok);
+}
+
+/* Entry of key in the table being moved to the current one, if any */
+static struct oalp_entry *sys_hashmap_oa_lp_find_old(const struct sys_hashmap *map, uint64_t key)
+{
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct oalp_entry *entry;
+	const struct sys_hashmap_oa_lp_data *data = (const struct sys_hashmap_oa_lp_data *)map->data;
+
+	if (data->old_buckets == NULL) {
+		return NULL;
+	}
+
+	entry = sys_hashmap_oa_lp_find_in(data->old_buckets, data->old_n_buckets,
+					  map->hash_func(&key, sizeof(key)), key, true, true,
+					  false);
+	if (entry == NULL || entry->state == UNUSED) {
+		return NULL;
+	}
+
+	return entry;
+#else
+	ARG_UNUSED(map);
+	ARG_UNUSED(key);
+
+	return NULL;
+#endif
+}
+
 static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
 					      uint64_t *old_value)
 {
@@ -109,6 +144,42 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	return ret;
 }
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+/*
+ * Move up to n buckets of the previous table to the current one. Moved entries
+ * become tombstones so that the probe sequences of the previous table remain
+ * intact.
+ */
+static void sys_hashmap_oa_lp_migrate(struct sys_hashmap *map, size_t n)
+{
+	struct oalp_entry *entry;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *const old_buckets = data->old_buckets;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	for (; n > 0 && data->rehash_pos < data->old_n_buckets; --n, ++data->rehash_pos) {
+		entry = &old_buckets[data->rehash_pos];
+
+		if (entry->state == USED) {
+			sys_hashmap_oa_lp_insert_no_rehash(map, entry->key, entry->value, NULL);
+			/* the entry was already accounted for */
+			--data->size;
+			entry->state = TOMBSTONE;
+		}
+	}
+
+	if (data->rehash_pos == data->old_n_buckets) {
+		map->alloc_func(old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->rehash_pos = 0;
+	}
+}
+#endif
+
 static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 {
 	size_t old_size;
@@ -127,6 +198,11 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 		return -ENOSPC;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	/* resizing again before the previous table is moved should be rare */
+	sys_hashmap_oa_lp_migrate(map, SIZE_MAX);
+#endif
+
 	/* extract all entries from the hashmap */
 	old_size = data->size;
 	old_n_buckets = data->n_buckets;
@@ -145,6 +221,18 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	data->size = 0;
 	data->buckets = new_buckets;
 	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	if (old_size != 0) {
+		/* entries are moved by the following insertions and removals */
+		data->size = old_size;
+		data->old_buckets = old_buckets;
+		data->old_n_buckets = old_n_buckets;
+		data->rehash_pos = 0;
+		return 0;
+	}
+#endif
 
 	/* re-insert all entries into the hashmap */
 	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
@@ -162,27 +250,49 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	return 0;
 }
 
+/* Bucket i of the current table followed by the one being moved, if any */
+static struct oalp_entry *sys_hashmap_oa_lp_bucket(const struct sys_hashmap *map, size_t i)
+{
+	const struct sys_hashmap_oa_lp_data *data = (const struct sys_hashmap_oa_lp_data *)map->data;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	if (i >= data->n_buckets) {
+		return &((struct oalp_entry *)data->old_buckets)[i - data->n_buckets];
+	}
+#endif
+
+	return &((struct oalp_entry *)data->buckets)[i];
+}
+
+static size_t sys_hashmap_oa_lp_total_buckets(const struct sys_hashmap *map)
+{
+	const struct sys_hashmap_oa_lp_data *data = (const struct sys_hashmap_oa_lp_data *)map->data;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	return data->n_buckets + data->old_n_buckets;
+#else
+	return data->n_buckets;
+#endif
+}
+
 static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 {
 	size_t i;
 	struct oalp_entry *entry;
 	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
-	struct oalp_entry *buckets = map->data->buckets;
+	const size_t n_buckets = sys_hashmap_oa_lp_total_buckets(map);
 
 	__ASSERT(it->size == map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
 
-	if (it->pos == 0) {
-		it->state = buckets;
-	}
-
-	i = (struct oalp_entry *)it->state - buckets;
-	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+	/* the state is the index of the next bucket to look at */
+	i = (it->pos == 0) ? 0 : (uintptr_t)it->state;
+	__ASSERT(i < n_buckets, "Invalid iterator state %p", it->state);
 
-	for (; i < map->data->n_buckets; ++i) {
-		entry = &buckets[i];
+	for (; i < n_buckets; ++i) {
+		entry = sys_hashmap_oa_lp_bucket(map, i);
 		if (entry->state == USED) {
-			it->state = &buckets[i + 1];
+			it->state = (void *)(uintptr_t)(i + 1);
 			it->key = entry->key;
 			it->value = entry->value;
 			++it->pos;
@@ -210,10 +320,10 @@ static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callbac
 {
 	struct oalp_entry *entry;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
-	struct oalp_entry *buckets = data->buckets;
+	const size_t n_buckets = sys_hashmap_oa_lp_total_buckets(map);
 
-	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
-		entry = &buckets[i];
+	for (size_t i = 0, j = 0; cb != NULL && i < n_buckets && j < data->size; ++i) {
+		entry = sys_hashmap_oa_lp_bucket(map, i);
 		if (entry->state == USED) {
 			cb(entry->key, entry->value, cookie);
 			++j;
@@ -225,6 +335,16 @@ static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callbac
 		data->buckets = NULL;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	if (data->old_buckets != NULL) {
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+	}
+
+	data->old_n_buckets = 0;
+	data->rehash_pos = 0;
+#endif
+
 	data->n_buckets = 0;
 	data->size = 0;
 	data->n_tombstones = 0;
@@ -234,12 +354,29 @@ static inline int sys_hashmap_oa_lp_insert(struct sys_hashmap *map, uint64_t key
 					   uint64_t *old_value)
 {
 	int ret;
+	struct oalp_entry *entry;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
 
 	ret = sys_hashmap_oa_lp_rehash(map, true);
 	if (ret < 0) {
 		return ret;
 	}
 
+	/* keys not moved yet are updated in place */
+	entry = sys_hashmap_oa_lp_find_old(map, key);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
 	return sys_hashmap_oa_lp_insert_no_rehash(map, key, value, old_value);
 }
 
@@ -248,9 +385,19 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 	struct oalp_entry *entry;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
+
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
-	if (entry == NULL || entry->state == UNUSED) {
-		return false;
+	if (entry != NULL && entry->state == USED) {
+		++data->n_tombstones;
+	} else {
+		/* tombstones of the previous table are not accounted for */
+		entry = sys_hashmap_oa_lp_find_old(map, key);
+		if (entry == NULL) {
+			return false;
+		}
 	}
 
 	if (value != NULL) {
@@ -259,7 +406,6 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 
 	entry->state = TOMBSTONE;
 	--data->size;
-	++data->n_tombstones;
 
 	/* ignore a possible -ENOMEM since the table will remain intact */
 	(void)sys_hashmap_oa_lp_rehash(map, false);
@@ -273,7 +419,10 @@ static bool sys_hashmap_oa_lp_get(const struct sys_hashmap *map, uint64_t key, u
 
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
-		return false;
+		entry = sys_hashmap_oa_lp_find_old(map, key);
+		if (entry == NULL) {
+			return false;
+		}
 	}
 
 	if (value != NULL) {
@@ -30,12 +30,25 @@ static void sys_hashmap_sc_entry_init(struct sys_hashmap_sc_entry *entry, uint64
 	sys_dnode_init(&entry->node);
 }
 
-static void sys_hashmap_sc_insert_entry(struct sys_hashmap *map, struct sys_hashmap_sc_entry *entry)
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_sc_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+/* Bucket of key in the current table */
+static sys_dlist_t *sys_hashmap_sc_bucket(const struct sys_hashmap *map, uint64_t key)
 {
 	sys_dlist_t *buckets = map->data->buckets;
-	uint32_t hash = map->hash_func(&entry->key, sizeof(entry->key));
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	return &buckets[hash % map->data->n_buckets];
+}
 
-	sys_dlist_append(&buckets[hash % map->data->n_buckets], &entry->node);
+static void sys_hashmap_sc_insert_entry(struct sys_hashmap *map, struct sys_hashmap_sc_entry *entry)
+{
+	sys_dlist_append(sys_hashmap_sc_bucket(map, entry->key), &entry->node);
 	++map->data->size;
 }
 
@@ -50,16 +63,41 @@ static void sys_hashmap_sc_insert_all(struct sys_hashmap *map, sys_dlist_t *list
 	}
 }
 
+/* Bucket i of the current table followed by the one being moved, if any */
+static sys_dlist_t *sys_hashmap_sc_bucket_at(const struct sys_hashmap *map, size_t i)
+{
+	const struct sys_hashmap_sc_data *data = (const struct sys_hashmap_sc_data *)map->data;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	if (i >= data->n_buckets) {
+		return &((sys_dlist_t *)data->old_buckets)[i - data->n_buckets];
+	}
+#endif
+
+	return &((sys_dlist_t *)data->buckets)[i];
+}
+
+static size_t sys_hashmap_sc_total_buckets(const struct sys_hashmap *map)
+{
+	const struct sys_hashmap_sc_data *data = (const struct sys_hashmap_sc_data *)map->data;
+
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	return data->n_buckets + data->old_n_buckets;
+#else
+	return data->n_buckets;
+#endif
+}
+
 static void sys_hashmap_sc_to_list(struct sys_hashmap *map, sys_dlist_t *list)
 {
 	sys_dlist_t *bucket;
 	struct sys_hashmap_sc_entry *entry;
-	sys_dlist_t *buckets = map->data->buckets;
+	const size_t n_buckets = sys_hashmap_sc_total_buckets(map);
 
 	sys_dlist_init(list);
 
-	for (size_t i = 0; i < map->data->n_buckets; ++i) {
-		bucket = &buckets[i];
+	for (size_t i = 0; i < n_buckets; ++i) {
+		bucket = sys_hashmap_sc_bucket_at(map, i);
 		while (!sys_dlist_is_empty(bucket)) {
 			entry = CONTAINER_OF(sys_dlist_get(bucket), struct sys_hashmap_sc_entry,
 					     node);
@@ -68,6 +106,37 @@ static void sys_hashmap_sc_to_list(struct sys_hashmap *map, sys_dlist_t *list)
 	}
 }
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+/* Move up to n buckets of the previous table to the current one */
+static void sys_hashmap_sc_migrate(struct sys_hashmap *map, size_t n)
+{
+	sys_dlist_t *bucket;
+	sys_dnode_t *node;
+	struct sys_hashmap_sc_entry *entry;
+	struct sys_hashmap_sc_data *data = (struct sys_hashmap_sc_data *)map->data;
+	sys_dlist_t *const old_buckets = data->old_buckets;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	for (; n > 0 && data->rehash_pos < data->old_n_buckets; --n, ++data->rehash_pos) {
+		bucket = &old_buckets[data->rehash_pos];
+		while ((node = sys_dlist_get(bucket)) != NULL) {
+			entry = CONTAINER_OF(node, struct sys_hashmap_sc_entry, node);
+			sys_dlist_append(sys_hashmap_sc_bucket(map, entry->key), &entry->node);
+		}
+	}
+
+	if (data->rehash_pos == data->old_n_buckets) {
+		map->alloc_func(old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->rehash_pos = 0;
+	}
+}
+#endif
+
 static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 {
 	sys_dlist_t list;
@@ -79,6 +148,34 @@ static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 		return 0;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct sys_hashmap_sc_data *data = (struct sys_hashmap_sc_data *)map->data;
+
+	/* resizing again before the previous table is moved should be rare */
+	sys_hashmap_sc_migrate(map, SIZE_MAX);
+
+	if (data->size != 0) {
+		new_buckets = (sys_dlist_t *)map->alloc_func(NULL,
+							     new_n_buckets * sizeof(*new_buckets));
+		if (new_buckets == NULL) {
+			return -ENOMEM;
+		}
+
+		for (size_t i = 0; i < new_n_buckets; ++i) {
+			sys_dlist_init(&new_buckets[i]);
+		}
+
+		/* entries are moved by the following insertions and removals */
+		data->old_buckets = data->buckets;
+		data->old_n_buckets = data->n_buckets;
+		data->rehash_pos = 0;
+		data->buckets = new_buckets;
+		data->n_buckets = new_n_buckets;
+
+		return 0;
+	}
+#endif
+
 	/* extract all entries from the hashmap */
 	sys_hashmap_sc_to_list(map, &list);
 
@@ -106,10 +203,22 @@ static int sys_hashmap_sc_rehash(struct sys_hashmap *map, bool grow)
 	return 0;
 }
 
+static struct sys_hashmap_sc_entry *sys_hashmap_sc_find_in(sys_dlist_t *bucket, uint64_t key)
+{
+	struct sys_hashmap_sc_entry *entry;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
+		if (entry->key == key) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
 static struct sys_hashmap_sc_entry *sys_hashmap_sc_find(const struct sys_hashmap *map, uint64_t key)
 {
 	uint32_t hash;
-	sys_dlist_t *bucket;
 	sys_dlist_t *buckets;
 	struct sys_hashmap_sc_entry *entry;
 
@@ -121,35 +230,41 @@ static struct sys_hashmap_sc_entry *sys_hashmap_sc_find(const struct sys_hashmap
 
 	hash = map->hash_func(&key, sizeof(key));
 	buckets = (sys_dlist_t *)map->data->buckets;
-	bucket = &buckets[hash % map->data->n_buckets];
+	entry = sys_hashmap_sc_find_in(&buckets[hash % map->data->n_buckets], key);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
-		if (entry->key == key) {
-			return entry;
-		}
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	const struct sys_hashmap_sc_data *data = (const struct sys_hashmap_sc_data *)map->data;
+
+	if (entry == NULL && data->old_buckets != NULL) {
+		buckets = (sys_dlist_t *)data->old_buckets;
+		entry = sys_hashmap_sc_find_in(&buckets[hash % data->old_n_buckets], key);
 	}
+#endif
 
-	return NULL;
+	return entry;
 }
 
 static void sys_hashmap_sc_iter_next(struct sys_hashmap_iterator *it)
 {
+	size_t i;
 	sys_dlist_t *bucket;
 	bool found_previous_key = false;
 	struct sys_hashmap_sc_entry *entry;
 	const struct sys_hashmap *map = it->map;
-	sys_dlist_t *buckets = map->data->buckets;
+	const size_t n_buckets = sys_hashmap_sc_total_buckets(map);
 
 	__ASSERT(it->size == map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
 
+	/* the state is the index of the bucket of the previous key */
+	i = (uintptr_t)it->state;
 	if (it->pos == 0) {
-		/* at position 0, state equals the beginning of the bucket array */
-		it->state = buckets;
+		/* at position 0, state is the first bucket */
 		found_previous_key = true;
 	}
 
-	for (bucket = it->state; bucket < &buckets[map->data->n_buckets]; ++bucket) {
+	for (; i < n_buckets; ++i) {
+		bucket = sys_hashmap_sc_bucket_at(map, i);
 		SYS_DLIST_FOR_EACH_CONTAINER(bucket, entry, node) {
 			if (!found_previous_key) {
 				if (entry->key == it->key) {
@@ -161,7 +276,7 @@ static void sys_hashmap_sc_iter_next(struct sys_hashmap_iterator *it)
 
 			/* save the bucket to state so we can restart scanning from a saved position
 			 */
-			it->state = bucket;
+			it->state = (void *)(uintptr_t)i;
 			it->key = entry->key;
 			it->value = entry->value;
 			++it->pos;
@@ -181,7 +296,7 @@ static void sys_hashmap_sc_iter(const struct sys_hashmap *map, struct sys_hashma
 {
 	it->map = map;
 	it->next = sys_hashmap_sc_iter_next;
-	it->state = map->data->buckets;
+	it->state = (void *)(uintptr_t)0;
 	it->key = 0;
 	it->value = 0;
 	it->pos = 0;
@@ -201,6 +316,18 @@ static void sys_hashmap_sc_clear(struct sys_hashmap *map, sys_hashmap_callback_t
 		map->data->buckets = NULL;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	struct sys_hashmap_sc_data *data = (struct sys_hashmap_sc_data *)map->data;
+
+	if (data->old_buckets != NULL) {
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+	}
+
+	data->old_n_buckets = 0;
+	data->rehash_pos = 0;
+#endif
+
 	map->data->n_buckets = 0;
 	map->data->size = 0;
 
@@ -223,6 +350,10 @@ static int sys_hashmap_sc_insert(struct sys_hashmap *map, uint64_t key, uint64_t
 	int ret;
 	struct sys_hashmap_sc_entry *entry;
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_sc_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
+
 	entry = sys_hashmap_sc_find(map, key);
 	if (entry != NULL) {
 		if (old_value != NULL) {
@@ -255,6 +386,10 @@ static bool sys_hashmap_sc_remove(struct sys_hashmap *map, uint64_t key, uint64_
 	__unused int ret;
 	struct sys_hashmap_sc_entry *entry;
 
+#ifdef CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH
+	sys_hashmap_sc_migrate(map, CONFIG_SYS_HASH_MAP_REHASH_STEP);
+#endif
+
 	entry = sys_hashmap_sc_find(map, key);
 	if (entry == NULL) {
 		return false;
@@ -268,8 +403,10 @@ static bool sys_hashmap_sc_remove(struct sys_hashmap *map, uint64_t key, uint64_
 	--map->data->size;
 
 	ret = sys_hashmap_sc_rehash(map, false);
-	/* Realloc to a smaller size of memory should *always* work */
-	__ASSERT_NO_MSG(ret >= 0);
+	/* Realloc to a smaller size of memory should *always* work, while incremental rehashing
+	 * allocates a new table and leaves the current one intact on failure
+	 */
+	__ASSERT_NO_MSG(ret >= 0 || IS_ENABLED(CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH));
 
 	/* free the entry */
 	map->alloc_func(entry, 0);
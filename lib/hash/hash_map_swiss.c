@@ -0,0 +1,420 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Open-Addressing Hashmap with group probing, after the "Swiss table" design.
+ *
+ * The table is a single allocation of n_buckets entries followed by one
+ * control byte per entry. A control byte is either EMPTY, DELETED or, for a
+ * used entry, the 7 low bits of the hash of its key (H2). The remaining bits
+ * of the hash (H1) select the first group of GROUP_WIDTH buckets to look at,
+ * and groups are then visited with a triangular sequence, which covers all of
+ * them since their number is a power of two.
+ *
+ * A lookup compares the control bytes of a whole group with H2 at once and
+ * only compares the keys of the matching entries, and stops at the first
+ * group with an EMPTY byte. So a removed entry may only become EMPTY again if
+ * its group has an EMPTY byte, i.e. if no probe ever went past the group, and
+ * otherwise becomes a DELETED tombstone until the next rehash.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_neon.h>
+#endif
+
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xFE
+
+#define H1(_hash) ((_hash) >> 7)
+#define H2(_hash) ((uint8_t)((_hash) & 0x7F))
+
+/* a used entry has the high bit of its control byte clear */
+#define CTRL_IS_USED(_ctrl) (((_ctrl) & 0x80) == 0)
+
+struct swiss_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+/* sys_hashmap_should_rehash() looks at the data as Open-Addressing / Linear Probe data */
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_oa_lp_data, size));
+
+/*
+ * Group matching. Each function returns a mask with one bit, or one byte for
+ * the 8-byte groups, set per matching control byte, the lowest for the first.
+ */
+
+#if defined(__SSE2__)
+
+#define GROUP_WIDTH 16
+#define GROUP_SHIFT 0
+
+static inline uint64_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+static inline uint64_t group_match_empty(const uint8_t *ctrl)
+{
+	return group_match(ctrl, CTRL_EMPTY);
+}
+
+static inline uint64_t group_match_free(const uint8_t *ctrl)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (uint16_t)_mm_movemask_epi8(group);
+}
+
+#else /* 8-byte groups */
+
+#define GROUP_WIDTH 8
+#define GROUP_SHIFT 3
+
+#define LSBS 0x0101010101010101ULL
+#define MSBS 0x8080808080808080ULL
+
+static inline uint64_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+#if defined(__ARM_NEON) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	uint8x8_t eq = vceq_u8(vld1_u8(ctrl), vdup_n_u8(h2));
+
+	return vget_lane_u64(vreinterpret_u64_u8(eq), 0) & MSBS;
+#else
+	/* the bytes of x equal to h2 are zero, find them without false positives */
+	uint64_t x = sys_get_le64(ctrl) ^ (LSBS * h2);
+
+	return ~(((x & ~MSBS) + ~MSBS) | x | ~MSBS);
+#endif
+}
+
+static inline uint64_t group_match_empty(const uint8_t *ctrl)
+{
+	uint64_t group = sys_get_le64(ctrl);
+
+	/* EMPTY is the only control byte with bit 7 set and bit 6 clear */
+	return group & ~(group << 1) & MSBS;
+}
+
+static inline uint64_t group_match_free(const uint8_t *ctrl)
+{
+	return sys_get_le64(ctrl) & MSBS;
+}
+
+#endif /* __SSE2__ */
+
+static inline size_t group_mask_index(uint64_t mask)
+{
+	return u64_count_trailing_zeros(mask) >> GROUP_SHIFT;
+}
+
+static inline uint8_t *sys_hashmap_swiss_ctrl(const struct sys_hashmap_swiss_data *data)
+{
+	return (uint8_t *)&((struct swiss_entry *)data->buckets)[data->n_buckets];
+}
+
+static struct swiss_entry *sys_hashmap_swiss_find(const struct sys_hashmap *map, uint64_t key,
+						  uint32_t hash)
+{
+	size_t i;
+	uint64_t mask;
+	const uint8_t *group;
+	const struct sys_hashmap_swiss_data *data =
+		(const struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const entries = data->buckets;
+	const uint8_t *const ctrl = sys_hashmap_swiss_ctrl(data);
+	const size_t n_groups = data->n_buckets / GROUP_WIDTH;
+
+	for (size_t g = H1(hash), step = 1; step <= n_groups; g += step, ++step) {
+		g &= n_groups - 1;
+		group = &ctrl[g * GROUP_WIDTH];
+
+		for (mask = group_match(group, H2(hash)); mask != 0; mask &= mask - 1) {
+			i = g * GROUP_WIDTH + group_mask_index(mask);
+			if (entries[i].key == key) {
+				return &entries[i];
+			}
+		}
+
+		if (group_match_empty(group) != 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void sys_hashmap_swiss_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					       uint64_t value, uint32_t hash)
+{
+	size_t i;
+	uint64_t mask;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const entries = data->buckets;
+	uint8_t *const ctrl = sys_hashmap_swiss_ctrl(data);
+	const size_t n_groups = data->n_buckets / GROUP_WIDTH;
+
+	for (size_t g = H1(hash), step = 1; step <= n_groups; g += step, ++step) {
+		g &= n_groups - 1;
+
+		mask = group_match_free(&ctrl[g * GROUP_WIDTH]);
+		if (mask == 0) {
+			continue;
+		}
+
+		i = g * GROUP_WIDTH + group_mask_index(mask);
+		if (ctrl[i] == CTRL_DELETED) {
+			--data->n_tombstones;
+		}
+
+		ctrl[i] = H2(hash);
+		entries[i].key = key;
+		entries[i].value = value;
+		++data->size;
+
+		return;
+	}
+
+	__ASSERT(false, "No free bucket, the load factor should prevent this");
+}
+
+static int sys_hashmap_swiss_rehash(struct sys_hashmap *map, bool grow)
+{
+	uint8_t *old_ctrl;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	struct swiss_entry *entry;
+	struct swiss_entry *old_buckets;
+	struct swiss_entry *new_buckets;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* buckets come in whole groups */
+	if (new_n_buckets != 0 && new_n_buckets < GROUP_WIDTH) {
+		new_n_buckets = GROUP_WIDTH;
+	}
+
+	if (new_n_buckets == data->n_buckets) {
+		return 0;
+	}
+
+	new_buckets = map->alloc_func(NULL, new_n_buckets * (sizeof(*entry) + sizeof(*old_ctrl)));
+	if (new_buckets == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	old_n_buckets = data->n_buckets;
+	old_buckets = data->buckets;
+	old_ctrl = sys_hashmap_swiss_ctrl(data);
+
+	data->size = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+
+	if (new_buckets != NULL) {
+		/* ensure all buckets are empty / initialized */
+		memset(sys_hashmap_swiss_ctrl(data), CTRL_EMPTY, new_n_buckets);
+	}
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0; i < old_n_buckets; ++i) {
+		if (CTRL_IS_USED(old_ctrl[i])) {
+			entry = &old_buckets[i];
+			sys_hashmap_swiss_insert_no_rehash(map, entry->key, entry->value,
+							   map->hash_func(&entry->key,
+									  sizeof(entry->key)));
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_buckets, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct swiss_entry *entries;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	const struct sys_hashmap_swiss_data *data =
+		(const struct sys_hashmap_swiss_data *)map->data;
+	const uint8_t *const ctrl = sys_hashmap_swiss_ctrl(data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	/* the state is the index of the next bucket to look at */
+	i = (it->pos == 0) ? 0 : (uintptr_t)it->state;
+	__ASSERT(i < data->n_buckets, "Invalid iterator state %p", it->state);
+
+	entries = data->buckets;
+	for (; i < data->n_buckets; ++i) {
+		if (CTRL_IS_USED(ctrl[i])) {
+			it->state = (void *)(uintptr_t)(i + 1);
+			it->key = entries[i].key;
+			it->value = entries[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_entry *const entries = data->buckets;
+	const uint8_t *const ctrl = sys_hashmap_swiss_ctrl(data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (CTRL_IS_USED(ctrl[i])) {
+			cb(entries[i].key, entries[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+	data->n_tombstones = 0;
+}
+
+static int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	struct swiss_entry *entry;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	entry = sys_hashmap_swiss_find(map, key, hash);
+	if (entry != NULL) {
+		if (old_value != NULL) {
+			*old_value = entry->value;
+		}
+
+		entry->value = value;
+
+		return 0;
+	}
+
+	ret = sys_hashmap_swiss_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sys_hashmap_swiss_insert_no_rehash(map, key, value, hash);
+
+	return 1;
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+	uint8_t *ctrl;
+	struct swiss_entry *entry;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	entry = sys_hashmap_swiss_find(map, key, map->hash_func(&key, sizeof(key)));
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	ctrl = sys_hashmap_swiss_ctrl(data);
+	i = entry - (struct swiss_entry *)data->buckets;
+
+	/* no probe went past a group which still has an empty bucket */
+	if (group_match_empty(&ctrl[ROUND_DOWN(i, GROUP_WIDTH)]) != 0) {
+		ctrl[i] = CTRL_EMPTY;
+	} else {
+		ctrl[i] = CTRL_DELETED;
+		++data->n_tombstones;
+	}
+
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_swiss_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct swiss_entry *entry;
+
+	entry = sys_hashmap_swiss_find(map, key, map->hash_func(&key, sizeof(key)));
+	if (entry == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
@@ -24,6 +24,30 @@ typedef uintptr_t mem_word_t;
 
 #endif
 
+#include "string_simd.h"
+
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+
+#define Z_MEM_WORD_MASK  (sizeof(mem_word_t) - 1)
+#define Z_MEM_WORD_ONES  ((mem_word_t)-1 / 0xff)
+#define Z_MEM_WORD_HIGHS (Z_MEM_WORD_ONES << 7)
+
+/*
+ * Non-zero if any byte of the word is zero. Bytes following the first zero
+ * byte may be flagged as well, so the exact position is found bytewise.
+ */
+static inline mem_word_t mem_word_has_zero(mem_word_t w)
+{
+	return (w - Z_MEM_WORD_ONES) & ~w & Z_MEM_WORD_HIGHS;
+}
+
+static inline mem_word_t mem_word_splat(unsigned char c)
+{
+	return Z_MEM_WORD_ONES * c;
+}
+
+#endif
+
 /**
  *
  * @brief Copy a string
@@ -118,16 +142,59 @@ char *strrchr(const char *s, int c)
  * @return number of bytes in string <s>
  */
 
-size_t strlen(const char *s)
+__noasan size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *p = s;
+
+#if defined(Z_STRING_SIMD)
+	/*
+	 * Only aligned blocks are read. They never cross a page or memory
+	 * protection boundary, so reading past the terminator is harmless.
+	 */
+	const z_vec_t zero = z_vec_splat(0);
+	uintptr_t offset = (uintptr_t)s & (Z_VEC_SIZE - 1);
+	uint64_t mask;
+
+	p = (const char *)((uintptr_t)s - offset);
+	mask = z_vec_eq_mask(z_vec_load_aligned(p), zero) >> (offset << Z_VEC_MASK_SHIFT);
+	if (mask != 0) {
+		return z_vec_mask_first(mask);
+	}
 
-	while (*s != '\0') {
-		s++;
-		n++;
+	do {
+		p += Z_VEC_SIZE;
+		mask = z_vec_eq_mask(z_vec_load_aligned(p), zero);
+	} while (mask == 0);
+
+	return (size_t)(p - s) + z_vec_mask_first(mask);
+#else
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* do byte-sized scanning until word-aligned */
+
+	while (((uintptr_t)p) & Z_MEM_WORD_MASK) {
+		if (*p == '\0') {
+			return (size_t)(p - s);
+		}
+		p++;
+	}
+
+	/* skip the words without a terminator */
+
+	const mem_word_t *p_word = (const mem_word_t *)p;
+
+	while (mem_word_has_zero(*p_word) == 0) {
+		p_word++;
+	}
+
+	p = (const char *)p_word;
+#endif
+
+	while (*p != '\0') {
+		p++;
 	}
 
-	return n;
+	return (size_t)(p - s);
+#endif
 }
 
 /**
@@ -240,6 +307,47 @@ int memcmp(const void *m1, const void *m2, size_t n)
 		return 0;
 	}
 
+#if defined(Z_STRING_SIMD)
+	while (n >= Z_VEC_SIZE) {
+		uint64_t ne = ~z_vec_eq_mask(z_vec_load(c1), z_vec_load(c2)) & Z_VEC_MASK_ALL;
+
+		if (ne != 0) {
+			size_t i = z_vec_mask_first(ne);
+
+			return c1[i] - c2[i];
+		}
+
+		c1 += Z_VEC_SIZE;
+		c2 += Z_VEC_SIZE;
+		n -= Z_VEC_SIZE;
+	}
+
+	if (n == 0) {
+		return 0;
+	}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* attempt word-sized comparison only if areas have identical alignment */
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & Z_MEM_WORD_MASK) == 0) {
+		while ((((uintptr_t)c1) & Z_MEM_WORD_MASK) && (n > 1) && (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		/* skip equal words, leaving at least one byte to the loop below */
+
+		if ((((uintptr_t)c1) & Z_MEM_WORD_MASK) == 0) {
+			while ((n > sizeof(mem_word_t)) &&
+			       (*(const mem_word_t *)c1 == *(const mem_word_t *)c2)) {
+				c1 += sizeof(mem_word_t);
+				c2 += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
+		}
+	}
+#endif
+
 	while ((--n > 0) && (*c1 == *c2)) {
 		c1++;
 		c2++;
@@ -266,12 +374,56 @@ void *memmove(void *d, const void *s, size_t n)
 		 * Copy backwards to prevent the premature corruption of <src>.
 		 */
 
+#if defined(Z_STRING_SIMD)
+		while (n >= Z_VEC_SIZE) {
+			n -= Z_VEC_SIZE;
+			z_vec_store(&dest[n], z_vec_load(&src[n]));
+		}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & Z_MEM_WORD_MASK) == 0) {
+			while ((n > 0) && (((uintptr_t)&dest[n]) & Z_MEM_WORD_MASK)) {
+				n--;
+				dest[n] = src[n];
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				n -= sizeof(mem_word_t);
+				*(mem_word_t *)&dest[n] = *(const mem_word_t *)&src[n];
+			}
+		}
+#endif
+
 		while (n > 0) {
 			n--;
 			dest[n] = src[n];
 		}
 	} else {
 		/* It is safe to perform a forward-copy */
+#if defined(Z_STRING_SIMD)
+		while (n >= Z_VEC_SIZE) {
+			z_vec_store(dest, z_vec_load(src));
+			dest += Z_VEC_SIZE;
+			src += Z_VEC_SIZE;
+			n -= Z_VEC_SIZE;
+		}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & Z_MEM_WORD_MASK) == 0) {
+			while ((n > 0) && (((uintptr_t)dest) & Z_MEM_WORD_MASK)) {
+				*dest = *src;
+				dest++;
+				src++;
+				n--;
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				*(mem_word_t *)dest = *(const mem_word_t *)src;
+				dest += sizeof(mem_word_t);
+				src += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			*dest = *src;
 			dest++;
@@ -297,7 +449,16 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
-#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#if defined(Z_STRING_SIMD)
+	/* vector loads and stores don't need any particular alignment */
+
+	while (n >= Z_VEC_SIZE) {
+		z_vec_store(d_byte, z_vec_load(s_byte));
+		d_byte += Z_VEC_SIZE;
+		s_byte += Z_VEC_SIZE;
+		n -= Z_VEC_SIZE;
+	}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	const uintptr_t mask = sizeof(mem_word_t) - 1;
 
 	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
@@ -351,7 +512,15 @@ void *memset(void *buf, int c, size_t n)
 	unsigned char *d_byte = (unsigned char *)buf;
 	unsigned char c_byte = (unsigned char)c;
 
-#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#if defined(Z_STRING_SIMD)
+	const z_vec_t c_vec = z_vec_splat(c_byte);
+
+	while (n >= Z_VEC_SIZE) {
+		z_vec_store(d_byte, c_vec);
+		d_byte += Z_VEC_SIZE;
+		n -= Z_VEC_SIZE;
+	}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	while (((uintptr_t)d_byte) & (sizeof(mem_word_t) - 1)) {
 		if (n == 0) {
 			return buf;
@@ -363,13 +532,7 @@ void *memset(void *buf, int c, size_t n)
 	/* do word-sized initialization as long as possible */
 
 	mem_word_t *d_word = (mem_word_t *)d_byte;
-	mem_word_t c_word = (mem_word_t)c_byte;
-
-	c_word |= c_word << 8;
-	c_word |= c_word << 16;
-#if Z_MEM_WORD_T_WIDTH > 32
-	c_word |= c_word << 32;
-#endif
+	mem_word_t c_word = mem_word_splat(c_byte);
 
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
@@ -398,15 +561,52 @@ void *memset(void *buf, int c, size_t n)
 
 void *memchr(const void *s, int c, size_t n)
 {
-	if (n != 0) {
-		const unsigned char *p = s;
+	const unsigned char *p = s;
+	unsigned char c_byte = (unsigned char)c;
 
-		do {
-			if (*p++ == (unsigned char)c) {
-				return ((void *)(p - 1));
-			}
+#if defined(Z_STRING_SIMD)
+	const z_vec_t c_vec = z_vec_splat(c_byte);
+
+	while (n >= Z_VEC_SIZE) {
+		uint64_t mask = z_vec_eq_mask(z_vec_load(p), c_vec);
+
+		if (mask != 0) {
+			return (void *)(p + z_vec_mask_first(mask));
+		}
+
+		p += Z_VEC_SIZE;
+		n -= Z_VEC_SIZE;
+	}
+#elif !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* do byte-sized scanning until word-aligned */
 
-		} while (--n != 0);
+	while ((n > 0) && (((uintptr_t)p) & Z_MEM_WORD_MASK)) {
+		if (*p == c_byte) {
+			return (void *)p;
+		}
+		p++;
+		n--;
+	}
+
+	/* skip the words that don't contain the byte */
+
+	const mem_word_t *p_word = (const mem_word_t *)p;
+	const mem_word_t c_word = mem_word_splat(c_byte);
+
+	while ((n >= sizeof(mem_word_t)) && (mem_word_has_zero(*p_word ^ c_word) == 0)) {
+		p_word++;
+		n -= sizeof(mem_word_t);
+	}
+
+	p = (const unsigned char *)p_word;
+#endif
+
+	while (n > 0) {
+		if (*p == c_byte) {
+			return (void *)p;
+		}
+		p++;
+		n--;
 	}
 
 	return NULL;
@@ -0,0 +1,116 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Minimal vector abstraction for the string routines.
+ *
+ * Only the operations needed by string.c are provided: unaligned and
+ * aligned 16-byte loads, unaligned stores, byte splat and a byte-wise
+ * equality test returning a bit mask with (1 << Z_VEC_MASK_SHIFT) bits per
+ * byte, lowest address first. Z_STRING_SIMD is defined when an
+ * implementation is available for the target.
+ */
+
+#ifndef ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_
+#define ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(CONFIG_MINIMAL_LIBC_STRING_SIMD)
+
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+#define Z_STRING_SIMD
+
+typedef __m128i z_vec_t;
+
+#define Z_VEC_SIZE       16
+#define Z_VEC_MASK_SHIFT 0
+#define Z_VEC_MASK_ALL   0xffffULL
+
+static inline z_vec_t z_vec_load(const void *p)
+{
+	return _mm_loadu_si128((const __m128i *)p);
+}
+
+static inline z_vec_t z_vec_load_aligned(const void *p)
+{
+	return _mm_load_si128((const __m128i *)p);
+}
+
+static inline void z_vec_store(void *p, z_vec_t v)
+{
+	_mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline z_vec_t z_vec_splat(unsigned char c)
+{
+	return _mm_set1_epi8((char)c);
+}
+
+static inline uint64_t z_vec_eq_mask(z_vec_t a, z_vec_t b)
+{
+	return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+
+#include <arm_neon.h>
+
+#define Z_STRING_SIMD
+
+typedef uint8x16_t z_vec_t;
+
+#define Z_VEC_SIZE       16
+#define Z_VEC_MASK_SHIFT 2
+#define Z_VEC_MASK_ALL   UINT64_MAX
+
+static inline z_vec_t z_vec_load(const void *p)
+{
+	return vld1q_u8((const uint8_t *)p);
+}
+
+static inline z_vec_t z_vec_load_aligned(const void *p)
+{
+	return vld1q_u8((const uint8_t *)p);
+}
+
+static inline void z_vec_store(void *p, z_vec_t v)
+{
+	vst1q_u8((uint8_t *)p, v);
+}
+
+static inline z_vec_t z_vec_splat(unsigned char c)
+{
+	return vdupq_n_u8(c);
+}
+
+static inline uint64_t z_vec_eq_mask(z_vec_t a, z_vec_t b)
+{
+	/* narrow each 0x00/0xff byte of the comparison to a nibble */
+	uint16x8_t eq = vreinterpretq_u16_u8(vceqq_u8(a, b));
+
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(eq, 4)), 0);
+}
+
+#endif
+
+#if defined(Z_STRING_SIMD)
+
+/* index of the first matching byte in a non-zero mask */
+static inline size_t z_vec_mask_first(uint64_t mask)
+{
+	return (size_t)__builtin_ctzll(mask) >> Z_VEC_MASK_SHIFT;
+}
+
+#endif /* Z_STRING_SIMD */
+
+#endif /* CONFIG_MINIMAL_LIBC_STRING_SIMD */
+
+#endif /* ZEPHYR_LIB_LIBC_MINIMAL_SOURCE_STRING_STRING_SIMD_H_ */
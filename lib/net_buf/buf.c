@@ -162,6 +162,124 @@ const struct net_buf_data_cb net_buf_var_cb = {
 	.unref = mem_pool_data_unref,
 };
 
+static uint16_t arena_block_pop(struct net_buf_arena *arena)
+{
+	if (arena->free_count > 0U) {
+		return arena->free_blocks[--arena->free_count];
+	}
+
+	__ASSERT_NO_MSG(arena->uninit_count > 0U);
+
+	return arena->block_count - arena->uninit_count--;
+}
+
+static uint8_t *arena_data_alloc(struct net_buf *buf, size_t *size,
+				 k_timeout_t timeout)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	struct net_buf_arena *arena = buf_pool->alloc->alloc_data;
+	size_t need = GET_ALIGN(buf_pool) + ROUND_UP(*size, sizeof(void *));
+	struct net_buf_arena_block *block;
+	bool release = false;
+	k_spinlock_key_t key;
+	uint8_t *ref_count;
+
+	if (need > arena->block_size) {
+		NET_BUF_DBG("Requested size %zu doesn't fit in an arena block", *size);
+		return NULL;
+	}
+
+	key = k_spin_lock(&arena->lock);
+
+	if ((arena->current == NET_BUF_ARENA_NO_BLOCK) ||
+	    (arena->blocks[arena->current].used + need > arena->block_size)) {
+		uint16_t retired;
+
+		k_spin_unlock(&arena->lock, key);
+
+		/* Reserve a free block before switching to it */
+		if (k_sem_take(&arena->free_sem, timeout) != 0) {
+			return NULL;
+		}
+
+		key = k_spin_lock(&arena->lock);
+
+		retired = arena->current;
+		if ((retired != NET_BUF_ARENA_NO_BLOCK) &&
+		    (arena->blocks[retired].used + need <= arena->block_size)) {
+			/* Another allocation switched blocks meanwhile */
+			release = true;
+		} else {
+			arena->current = arena_block_pop(arena);
+			arena->blocks[arena->current].used = 0U;
+			arena->blocks[arena->current].live = 0U;
+
+			/* The retired block is freed by its last payload */
+			if ((retired != NET_BUF_ARENA_NO_BLOCK) &&
+			    (arena->blocks[retired].live == 0U)) {
+				arena->free_blocks[arena->free_count++] = retired;
+				release = true;
+			}
+		}
+	}
+
+	block = &arena->blocks[arena->current];
+	ref_count = arena->data + (size_t)arena->current * arena->block_size + block->used;
+	block->used += need;
+	block->live++;
+
+	k_spin_unlock(&arena->lock, key);
+
+	if (release) {
+		k_sem_give(&arena->free_sem);
+	}
+
+	*ref_count = 1U;
+
+	return ref_count + GET_ALIGN(buf_pool);
+}
+
+static void arena_data_unref(struct net_buf *buf, uint8_t *data)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	struct net_buf_arena *arena = buf_pool->alloc->alloc_data;
+	bool release = false;
+	k_spinlock_key_t key;
+	uint8_t *ref_count;
+	uint16_t idx;
+
+	ref_count = data - GET_ALIGN(buf_pool);
+	if (--(*ref_count)) {
+		return;
+	}
+
+	idx = (ref_count - arena->data) / arena->block_size;
+
+	key = k_spin_lock(&arena->lock);
+
+	if (--arena->blocks[idx].live == 0U) {
+		if (idx == arena->current) {
+			/* Start over in the current block */
+			arena->blocks[idx].used = 0U;
+		} else {
+			arena->free_blocks[arena->free_count++] = idx;
+			release = true;
+		}
+	}
+
+	k_spin_unlock(&arena->lock, key);
+
+	if (release) {
+		k_sem_give(&arena->free_sem);
+	}
+}
+
+const struct net_buf_data_cb net_buf_arena_cb = {
+	.alloc = arena_data_alloc,
+	.ref   = generic_data_ref,
+	.unref = arena_data_unref,
+};
+
 static uint8_t *fixed_data_alloc(struct net_buf *buf, size_t *size,
 			      k_timeout_t timeout)
 {
@@ -241,6 +359,42 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+/* Allocate the data of a buffer just taken from the pool and initialize it.
+ * The buffer is put back into the pool on failure.
+ */
+static bool buf_init(struct net_buf_pool *pool, struct net_buf *buf, size_t size,
+		     k_timepoint_t end)
+{
+	if (size) {
+		__maybe_unused size_t req_size = size;
+
+		buf->__buf = data_alloc(buf, &size, sys_timepoint_timeout(end));
+		if (!buf->__buf) {
+			net_buf_destroy(buf);
+			return false;
+		}
+
+		__ASSERT_NO_MSG(req_size <= size);
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	memset(buf->user_data, 0, buf->user_data_size);
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = max(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+	return true;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -327,37 +481,88 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-		__maybe_unused size_t req_size = size;
+	if (!buf_init(pool, buf, size, end)) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		return NULL;
+	}
 
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
+	return buf;
+}
+
+int net_buf_alloc_batch(struct net_buf_pool *pool, size_t size,
+			struct net_buf **bufs, size_t count)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_NO_WAIT);
+	k_spinlock_key_t key;
+	size_t got = 0;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(bufs || count == 0);
+
+	if (count > pool->buf_count) {
+		return -EINVAL;
+	}
+
+	/* Take what is available with a single pool lock, same as
+	 * net_buf_alloc_len() does for one buffer.
+	 */
+	key = k_spin_lock(&pool->lock);
+
+	while (got < count) {
+		if (pool->uninit_count < pool->buf_count) {
+			bufs[got] = k_lifo_get(&pool->free, K_NO_WAIT);
+			if (bufs[got]) {
+				got++;
+				continue;
+			}
 		}
 
-		__ASSERT_NO_MSG(req_size <= size);
-	} else {
-		buf->__buf = NULL;
+		if (pool->uninit_count == 0U) {
+			break;
+		}
+
+		bufs[got] = pool_get_uninit(pool, pool->uninit_count--);
+		got++;
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	memset(buf->user_data, 0, buf->user_data_size);
-	net_buf_reset(buf);
+	k_spin_unlock(&pool->lock, key);
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-	pool->max_used = max(pool->max_used,
-			     pool->buf_count - atomic_get(&pool->avail_count));
-#endif
-	return buf;
+	/* Never wait for the missing buffers while holding the others */
+	if (got < count) {
+		NET_BUF_ERR("Failed to get %zu free buffers", count);
+		goto put_back;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!buf_init(pool, bufs[i], size, end)) {
+			NET_BUF_ERR("Failed to allocate data");
+
+			for (size_t j = 0; j < i; j++) {
+				net_buf_unref(bufs[j]);
+			}
+
+			/* bufs[i] was put back by buf_init() */
+			bufs += i + 1;
+			got = count - i - 1;
+			goto put_back;
+		}
+	}
+
+	return 0;
+
+put_back:
+	if (got > 0) {
+		sys_slist_t list;
+
+		sys_slist_init(&list);
+		for (size_t i = 0; i < got; i++) {
+			sys_slist_append(&list, &bufs[i]->node);
+		}
+
+		k_queue_merge_slist(&pool->free._queue, &list);
+	}
+
+	return -ENOMEM;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -440,8 +645,13 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 void net_buf_unref(struct net_buf *buf)
 #endif
 {
+	struct net_buf_pool *free_pool = NULL;
+	sys_slist_t free_list;
+
 	__ASSERT_NO_MSG(buf);
 
+	sys_slist_init(&free_list);
+
 	while (buf) {
 		struct net_buf *frags = buf->frags;
 		struct net_buf_pool *pool;
@@ -452,13 +662,13 @@ void net_buf_unref(struct net_buf *buf)
 			NET_BUF_ERR("%s():%d: buf %p double free", func, line,
 				    buf);
 #endif
-			return;
+			break;
 		}
 		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
 			    buf->pool_id, buf->frags);
 
 		if (--buf->ref > 0) {
-			return;
+			break;
 		}
 
 		buf->data = NULL;
@@ -471,14 +681,35 @@ void net_buf_unref(struct net_buf *buf)
 		__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
 #endif
 
+		/* Collect the buffers going back to the same pool, so that
+		 * they are put into its free LIFO with a single operation.
+		 */
+		if (pool != free_pool) {
+			if (!sys_slist_is_empty(&free_list)) {
+				k_queue_merge_slist(&free_pool->free._queue, &free_list);
+			}
+			free_pool = pool;
+		}
+
 		if (pool->destroy) {
 			pool->destroy(buf);
 		} else {
-			net_buf_destroy(buf);
+			if (buf->__buf) {
+				if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+					pool->alloc->cb->unref(buf, buf->__buf);
+				}
+				buf->__buf = NULL;
+			}
+
+			sys_slist_append(&free_list, &buf->node);
 		}
 
 		buf = frags;
 	}
+
+	if (!sys_slist_is_empty(&free_list)) {
+		k_queue_merge_slist(&free_pool->free._queue, &free_list);
+	}
 }
 
 struct net_buf *net_buf_ref(struct net_buf *buf)
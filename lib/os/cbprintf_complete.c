@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/linker/utils.h>
 #include <sys/types.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/cbprintf.h>
@@ -1367,6 +1368,367 @@ static int outs(cbprintf_cb __out,
 	return (int)count;
 }
 
+#ifdef CONFIG_CBPRINTF_FORMAT_CACHE
+
+/* Conversions that the compiled format emitter supports. */
+enum fmt_conv_enum {
+	FMT_CONV_PERCENT,
+	FMT_CONV_SINT,
+	FMT_CONV_UINT,
+	FMT_CONV_HEX,
+	FMT_CONV_HEX_UPPER,
+	FMT_CONV_CHAR,
+	FMT_CONV_STR,
+	FMT_CONV_PTR,
+};
+
+/* A conversion and the literal text that precedes it in the format. */
+struct fmt_op {
+	uint16_t lit_len;
+	uint8_t spec_len;
+	uint8_t conv;
+	uint8_t length_mod;
+	uint8_t width;
+	bool flag_dash: 1;
+	bool flag_zero: 1;
+};
+
+enum fmt_entry_state {
+	FMT_ENTRY_EMPTY,
+	FMT_ENTRY_BUSY,
+	FMT_ENTRY_READY,
+};
+
+/* Cached format. Once ready an entry is immutable and never evicted, so
+ * it can be read without a lock from any context.
+ */
+struct fmt_entry {
+	uint32_t state;
+	bool compiled;
+	uint8_t op_cnt;
+	const char *fmt;
+	struct fmt_op ops[CONFIG_CBPRINTF_FORMAT_CACHE_CONVERSIONS];
+};
+
+/* Number of slots probed for a format before giving up. */
+#define FMT_CACHE_PROBES 4
+
+static struct fmt_entry fmt_cache[CONFIG_CBPRINTF_FORMAT_CACHE_SIZE];
+
+static inline bool fmt_is_static(const char *fp)
+{
+#if defined(CBPRINTF_VIA_UNIT_TEST)
+	/* Unit test formats are string literals, but there are no linker
+	 * symbols to check that.
+	 */
+	ARG_UNUSED(fp);
+
+	return true;
+#else
+	return linker_is_in_rodata(fp);
+#endif
+}
+
+/* Translate the format into ops, or return false if it has a conversion
+ * that must be interpreted.
+ */
+static bool fmt_compile(struct fmt_entry *entry, const char *fp)
+{
+	size_t op_cnt = 0;
+
+	while (true) {
+		const char *lp = fp;
+		struct conversion conv;
+		struct fmt_op *op;
+
+		while ((*fp != '\0') && (*fp != '%')) {
+			++fp;
+		}
+
+		if (*fp == '\0') {
+			break;
+		}
+
+		if ((op_cnt == ARRAY_SIZE(entry->ops)) || ((fp - lp) > UINT16_MAX)) {
+			return false;
+		}
+
+		const char *sp = fp;
+
+		fp = extract_conversion(&conv, sp);
+
+		if (conv.invalid || conv.unsupported || conv.width_star ||
+		    conv.prec_present || conv.flag_plus || conv.flag_space ||
+		    conv.flag_hash || (conv.width_value > UINT8_MAX)) {
+			return false;
+		}
+
+		op = &entry->ops[op_cnt];
+		*op = (struct fmt_op) {
+			.lit_len = sp - lp,
+			.spec_len = fp - sp,
+			.length_mod = conv.length_mod,
+			.width = conv.width_value,
+			.flag_dash = conv.flag_dash,
+			.flag_zero = conv.flag_zero,
+		};
+
+		switch (conv.specifier) {
+		case '%':
+			op->conv = FMT_CONV_PERCENT;
+			break;
+		case 'd':
+		case 'i':
+			op->conv = FMT_CONV_SINT;
+			break;
+		case 'u':
+			op->conv = FMT_CONV_UINT;
+			break;
+		case 'x':
+			op->conv = FMT_CONV_HEX;
+			break;
+		case 'X':
+			op->conv = FMT_CONV_HEX_UPPER;
+			break;
+		case 'c':
+			op->conv = FMT_CONV_CHAR;
+			break;
+		case 's':
+			op->conv = FMT_CONV_STR;
+			break;
+		case 'p':
+			/* keep the interpreter's padding of the 0x prefix */
+			if (op->width != 0U) {
+				return false;
+			}
+			op->conv = FMT_CONV_PTR;
+			break;
+		default:
+			return false;
+		}
+
+		switch (op->length_mod) {
+		case LENGTH_NONE:
+		case LENGTH_L:
+		case LENGTH_LL:
+		case LENGTH_Z:
+			break;
+		default:
+			return false;
+		}
+
+		++op_cnt;
+	}
+
+	entry->op_cnt = op_cnt;
+
+	return true;
+}
+
+/* Look up the format, compiling it on first use. Returns NULL if the
+ * format must be interpreted.
+ */
+static const struct fmt_entry *fmt_cache_get(const char *fp)
+{
+	size_t idx = (uintptr_t)fp % ARRAY_SIZE(fmt_cache);
+
+	if (!fmt_is_static(fp)) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < MIN(FMT_CACHE_PROBES, ARRAY_SIZE(fmt_cache)); i++) {
+		struct fmt_entry *entry = &fmt_cache[(idx + i) % ARRAY_SIZE(fmt_cache)];
+		uint32_t state = __atomic_load_n(&entry->state, __ATOMIC_ACQUIRE);
+
+		if (state == FMT_ENTRY_READY) {
+			if (entry->fmt == fp) {
+				return entry->compiled ? entry : NULL;
+			}
+			continue;
+		}
+
+		if ((state == FMT_ENTRY_EMPTY) &&
+		    __atomic_compare_exchange_n(&entry->state, &state, FMT_ENTRY_BUSY, false,
+						__ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+			entry->fmt = fp;
+			entry->compiled = fmt_compile(entry, fp);
+			__atomic_store_n(&entry->state, FMT_ENTRY_READY, __ATOMIC_RELEASE);
+
+			return entry->compiled ? entry : NULL;
+		}
+	}
+
+	return NULL;
+}
+
+/* Writes the value in decimal or hexadecimal backwards from bpe, with
+ * constant divisors so that no division instruction is needed.
+ */
+static char *fmt_encode_uint(uint_value_type value, enum fmt_conv_enum conv, char *bpe)
+{
+	char *bp = bpe;
+
+	if (conv == FMT_CONV_HEX || conv == FMT_CONV_HEX_UPPER || conv == FMT_CONV_PTR) {
+		const char *digits = (conv == FMT_CONV_HEX_UPPER) ? "0123456789ABCDEF"
+								  : "0123456789abcdef";
+
+		do {
+			*--bp = digits[value & 0xfU];
+			value >>= 4;
+		} while (value != 0U);
+	} else {
+		do {
+			*--bp = (char)('0' + (value % 10U));
+			value /= 10U;
+		} while (value != 0U);
+	}
+
+	return bp;
+}
+
+/* Emit a compiled format. Mirrors the output of z_cbvprintf_impl() for
+ * the subset of conversions accepted by fmt_compile().
+ */
+static int fmt_emit(cbprintf_cb __out, void *ctx, const char *fp,
+		    const struct fmt_entry *entry, va_list ap)
+{
+	char buf[CONVERTED_INT_BUFLEN];
+	size_t count = 0;
+	cbprintf_cb_local out = __out;
+
+#define OUTC(c) do { \
+	int rc = (*out)((int)(c), ctx); \
+	\
+	if (rc < 0) { \
+		return rc; \
+	} \
+	++count; \
+} while (false)
+
+#define OUTS(_sp, _ep) do { \
+	int rc = outs(out, ctx, (_sp), (_ep)); \
+	\
+	if (rc < 0) {	    \
+		return rc; \
+	} \
+	count += rc; \
+} while (false)
+
+	for (size_t i = 0; i < entry->op_cnt; i++) {
+		const struct fmt_op *op = &entry->ops[i];
+		const char *bps = NULL;
+		const char *bpe = buf + sizeof(buf);
+		sint_value_type sint;
+		uint_value_type uint;
+		char sign = 0;
+		int width;
+
+		OUTS(fp, fp + op->lit_len);
+		fp += op->lit_len + op->spec_len;
+
+		switch (op->conv) {
+		case FMT_CONV_PERCENT:
+			OUTC('%');
+			continue;
+		case FMT_CONV_SINT:
+			if (op->length_mod == LENGTH_L) {
+				sint = va_arg(ap, long);
+			} else if (op->length_mod == LENGTH_LL) {
+				sint = (sint_value_type)va_arg(ap, long long);
+			} else if (op->length_mod == LENGTH_Z) {
+				sint = (sint_value_type)va_arg(ap, ptrdiff_t);
+			} else {
+				sint = va_arg(ap, int);
+			}
+
+			if (sint < 0) {
+				sign = '-';
+				uint = (uint_value_type)-sint;
+			} else {
+				uint = (uint_value_type)sint;
+			}
+
+			bps = fmt_encode_uint(uint, FMT_CONV_SINT, buf + sizeof(buf));
+			break;
+		case FMT_CONV_UINT:
+		case FMT_CONV_HEX:
+		case FMT_CONV_HEX_UPPER:
+			if (op->length_mod == LENGTH_L) {
+				uint = va_arg(ap, unsigned long);
+			} else if (op->length_mod == LENGTH_LL) {
+				uint = (uint_value_type)va_arg(ap, unsigned long long);
+			} else if (op->length_mod == LENGTH_Z) {
+				uint = (uint_value_type)va_arg(ap, size_t);
+			} else {
+				uint = va_arg(ap, unsigned int);
+			}
+
+			bps = fmt_encode_uint(uint, op->conv, buf + sizeof(buf));
+			break;
+		case FMT_CONV_CHAR:
+			buf[0] = (char)va_arg(ap, int);
+			bps = buf;
+			bpe = buf + 1;
+			break;
+		case FMT_CONV_STR:
+			bps = va_arg(ap, const char *);
+			bpe = bps + strlen(bps);
+			break;
+		case FMT_CONV_PTR: {
+			void *ptr = va_arg(ap, void *);
+
+			if (ptr == NULL) {
+				bps = "(nil)";
+				bpe = bps + 5;
+			} else {
+				char *bp = fmt_encode_uint((uintptr_t)ptr, FMT_CONV_PTR,
+							   buf + sizeof(buf));
+
+				*--bp = 'x';
+				*--bp = '0';
+				bps = bp;
+			}
+			break;
+		}
+		default:
+			break;
+		}
+
+		width = (int)op->width - (int)(bpe - bps) - ((sign != 0) ? 1 : 0);
+
+		if (!op->flag_dash) {
+			if (op->flag_zero && (sign != 0)) {
+				OUTC(sign);
+				sign = 0;
+			}
+
+			while (width > 0) {
+				OUTC(op->flag_zero ? '0' : ' ');
+				--width;
+			}
+		}
+
+		if (sign != 0) {
+			OUTC(sign);
+		}
+
+		OUTS(bps, bpe);
+
+		while (width > 0) {
+			OUTC(' ');
+			--width;
+		}
+	}
+
+	OUTS(fp, NULL);
+
+	return count;
+#undef OUTS
+#undef OUTC
+}
+
+#endif /* CONFIG_CBPRINTF_FORMAT_CACHE */
+
 int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 		     va_list ap, uint32_t flags)
 {
@@ -1378,6 +1740,16 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 	const bool tagged_ap = (flags & Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS)
 			       == Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS;
 
+#ifdef CONFIG_CBPRINTF_FORMAT_CACHE
+	if (!tagged_ap) {
+		const struct fmt_entry *entry = fmt_cache_get(fp);
+
+		if (entry != NULL) {
+			return fmt_emit(__out, ctx, fp, entry, ap);
+		}
+	}
+#endif
+
 /* Output character, returning EOF if output failed, otherwise
  * updating count.
  *
@@ -1150,11 +1150,66 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+/* Same as Z_JSON_NAME_HASH(), for a key which is not a string literal */
+static uint8_t key_hash(const char *key, size_t key_len)
+{
+	if (key_len == 0) {
+		return 0;
+	}
+
+	return ((uint8_t)key[0] * 31U + (uint8_t)key[key_len - 1]) % 255U + 1U;
+}
+#endif
+
+/*
+ * Find the descriptor of a key among the fields not decoded yet, returns
+ * descr_len if there is none. Documents usually list their fields in the
+ * order of the descriptors, so the search starts after the last field found.
+ */
+static size_t field_find(const struct json_obj_descr *descr, size_t descr_len,
+			 int64_t decoded_fields, size_t start, const char *key, size_t key_len)
+{
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+	uint8_t hash = key_hash(key, key_len);
+#endif
+	size_t i = start;
+
+	for (size_t n = 0; n < descr_len; n++, i++) {
+		if (i >= descr_len) {
+			i = 0;
+		}
+
+		/* Field has been decoded already, skip */
+		if (decoded_fields & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		/* Check if it's the i-th field */
+		if (key_len != descr[i].field_name_len) {
+			continue;
+		}
+
+#ifdef CONFIG_JSON_LIBRARY_KEY_HASH
+		if ((descr[i].field_name_hash != 0U) && (descr[i].field_name_hash != hash)) {
+			continue;
+		}
+#endif
+
+		if (memcmp(key, descr[i].field_name, key_len) == 0) {
+			return i;
+		}
+	}
+
+	return descr_len;
+}
+
 static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 			 size_t descr_len, void *val)
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
+	size_t next_field = 0;
 	size_t i;
 	int ret;
 
@@ -1163,34 +1218,7 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
-
-			/* Field has been decoded already, skip */
-			if (decoded_fields & ((int64_t)1 << i)) {
-				continue;
-			}
-
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
-			}
-
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
-				continue;
-			}
-
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
-			if (ret < 0) {
-				return ret;
-			}
-
-			decoded_fields |= (int64_t)1<<i;
-			break;
-		}
+		i = field_find(descr, descr_len, decoded_fields, next_field, kv.key, kv.key_len);
 
 		/* Skip field, if no descriptor was found */
 		if (i >= descr_len) {
@@ -1198,7 +1226,17 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			if (ret < 0) {
 				return ret;
 			}
+			continue;
+		}
+
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value, (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
 		}
+
+		decoded_fields |= (int64_t)1<<i;
+		next_field = i + 1;
 	}
 
 	return -EINVAL;
@@ -1268,6 +1306,444 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+
+enum {
+	STREAM_EXPECT_OBJECT,
+	STREAM_EXPECT_KEY_OR_END,
+	STREAM_EXPECT_KEY,
+	STREAM_EXPECT_COLON,
+	STREAM_EXPECT_VALUE_OR_END,
+	STREAM_EXPECT_VALUE,
+	STREAM_EXPECT_COMMA_OR_END,
+	STREAM_EXPECT_NOTHING,
+};
+
+enum {
+	STREAM_LEX_NONE,
+	STREAM_LEX_STRING,
+	STREAM_LEX_ESCAPE,
+	STREAM_LEX_LITERAL,
+};
+
+static struct json_obj_stream_frame *stream_top(struct json_obj_stream *stream)
+{
+	return &stream->frames[stream->depth - 1];
+}
+
+static bool stream_expects_value(struct json_obj_stream *stream)
+{
+	return stream->expect == STREAM_EXPECT_VALUE ||
+	       stream->expect == STREAM_EXPECT_VALUE_OR_END;
+}
+
+/* Descriptor and storage of the value about to be parsed, NULL descriptor to skip it */
+static int stream_value_start(struct json_obj_stream *stream,
+			      const struct json_obj_descr **descr, void **field)
+{
+	struct json_obj_stream_frame *frame = stream_top(stream);
+
+	if (frame->array) {
+		if (*frame->count == frame->descr_len) {
+			return -ENOSPC;
+		}
+
+		*descr = frame->descr;
+		*field = (char *)frame->val + *frame->count * get_elem_size(frame->descr);
+	} else if (frame->field < frame->descr_len) {
+		*descr = &frame->descr[frame->field];
+		*field = (char *)frame->val + frame->descr[frame->field].offset;
+	} else {
+		*descr = NULL;
+	}
+
+	return 0;
+}
+
+static void stream_value_end(struct json_obj_stream *stream)
+{
+	struct json_obj_stream_frame *frame = stream_top(stream);
+
+	if (frame->array) {
+		(*frame->count)++;
+	} else if (frame->field < frame->descr_len) {
+		frame->decoded |= (int64_t)1 << frame->field;
+	}
+
+	stream->expect = STREAM_EXPECT_COMMA_OR_END;
+}
+
+static int stream_push(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+		       void *field)
+{
+	struct json_obj_stream_frame *parent = stream_top(stream);
+	struct json_obj_stream_frame *frame;
+
+	if (stream->depth == CONFIG_JSON_LIBRARY_STREAM_DEPTH) {
+		return -ENOSPC;
+	}
+
+	frame = &stream->frames[stream->depth];
+
+	if (descr->type == JSON_TOK_OBJECT_START) {
+		frame->descr = descr->object.sub_descr;
+		frame->descr_len = descr->object.sub_descr_len;
+		frame->decoded = 0;
+		frame->field = frame->descr_len;
+		frame->array = false;
+		stream->expect = STREAM_EXPECT_KEY_OR_END;
+	} else if (descr->type == JSON_TOK_ARRAY_START && !parent->array) {
+		/* The element count is stored next to the array, as with arr_parse() */
+		frame->descr = descr->array.element_descr;
+		frame->descr_len = descr->array.n_elements;
+		frame->count = (size_t *)((char *)parent->val + frame->descr->offset);
+		*frame->count = 0;
+		frame->array = true;
+		stream->expect = STREAM_EXPECT_VALUE_OR_END;
+	} else {
+		return -ENOTSUP;
+	}
+
+	frame->val = field;
+	stream->depth++;
+
+	return 0;
+}
+
+static int stream_punct(struct json_obj_stream *stream, char chr)
+{
+	struct json_obj_stream_frame *frame;
+	const struct json_obj_descr *descr;
+	void *field;
+	int ret;
+
+	if (stream->skip > 0) {
+		if (chr == '{' || chr == '[') {
+			if (stream->skip == UINT16_MAX) {
+				return -EINVAL;
+			}
+			stream->skip++;
+		} else if (chr == '}' || chr == ']') {
+			stream->skip--;
+			if (stream->skip == 0) {
+				stream_value_end(stream);
+			}
+		}
+
+		return 0;
+	}
+
+	if (stream->expect == STREAM_EXPECT_OBJECT) {
+		if (chr != '{') {
+			return -EINVAL;
+		}
+
+		stream->depth = 1;
+		stream->expect = STREAM_EXPECT_KEY_OR_END;
+		return 0;
+	}
+
+	switch (chr) {
+	case '{':
+	case '[':
+		if (!stream_expects_value(stream)) {
+			return -EINVAL;
+		}
+
+		ret = stream_value_start(stream, &descr, &field);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (descr == NULL) {
+			stream->skip = 1;
+			return 0;
+		}
+
+		if (!equivalent_types((enum json_tokens)chr, descr->type)) {
+			return -EINVAL;
+		}
+
+		return stream_push(stream, descr, field);
+	case '}':
+	case ']':
+		frame = stream_top(stream);
+
+		if (frame->array != (chr == ']')) {
+			return -EINVAL;
+		}
+
+		if (stream->expect != STREAM_EXPECT_COMMA_OR_END &&
+		    stream->expect != (frame->array ? STREAM_EXPECT_VALUE_OR_END
+						    : STREAM_EXPECT_KEY_OR_END)) {
+			return -EINVAL;
+		}
+
+		stream->depth--;
+		if (stream->depth == 0) {
+			stream->result = frame->decoded;
+			stream->expect = STREAM_EXPECT_NOTHING;
+			return 0;
+		}
+
+		stream_value_end(stream);
+		return 0;
+	case ':':
+		if (stream->expect != STREAM_EXPECT_COLON) {
+			return -EINVAL;
+		}
+
+		stream->expect = STREAM_EXPECT_VALUE;
+		return 0;
+	case ',':
+		if (stream->expect != STREAM_EXPECT_COMMA_OR_END) {
+			return -EINVAL;
+		}
+
+		stream->expect = stream_top(stream)->array ? STREAM_EXPECT_VALUE
+							   : STREAM_EXPECT_KEY;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+static int stream_scalar(struct json_obj_stream *stream, enum json_tokens type)
+{
+	struct json_token token = {
+		.type = type,
+		.start = stream->tok,
+		.end = stream->tok + stream->tok_len,
+	};
+	const struct json_obj_descr *descr;
+	void *field;
+	int ret;
+
+	if (!stream_expects_value(stream)) {
+		return -EINVAL;
+	}
+
+	ret = stream_value_start(stream, &descr, &field);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (descr != NULL) {
+		if (!equivalent_types(type, descr->type)) {
+			return -EINVAL;
+		}
+
+		/* These point into the input, which is not kept */
+		switch (descr->type) {
+		case JSON_TOK_STRING:
+		case JSON_TOK_OPAQUE:
+		case JSON_TOK_FLOAT:
+		case JSON_TOK_ENCODED_OBJ:
+			return -ENOTSUP;
+		default:
+			break;
+		}
+
+		if (stream->tok_overflow) {
+			return -EINVAL;
+		}
+
+		ret = decode_value(NULL, descr, &token, field, NULL);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	stream_value_end(stream);
+
+	return 0;
+}
+
+static int stream_string(struct json_obj_stream *stream)
+{
+	struct json_obj_stream_frame *frame;
+
+	if (stream->skip > 0) {
+		return 0;
+	}
+
+	if (stream->expect != STREAM_EXPECT_KEY_OR_END && stream->expect != STREAM_EXPECT_KEY) {
+		return stream_scalar(stream, JSON_TOK_STRING);
+	}
+
+	frame = stream_top(stream);
+	if (stream->tok_overflow) {
+		frame->field = frame->descr_len;
+	} else {
+		frame->field = field_find(frame->descr, frame->descr_len, frame->decoded,
+					  frame->field + 1, stream->tok, stream->tok_len);
+	}
+
+	stream->expect = STREAM_EXPECT_COLON;
+
+	return 0;
+}
+
+static int stream_literal(struct json_obj_stream *stream)
+{
+	const char *tok = stream->tok;
+	enum json_tokens type;
+
+	stream->tok[stream->tok_len] = '\0';
+
+	if (stream->tok_overflow) {
+		/* Only accepted if skipped */
+		type = JSON_TOK_NUMBER;
+	} else if (strcmp(tok, "true") == 0) {
+		type = JSON_TOK_TRUE;
+	} else if (strcmp(tok, "false") == 0) {
+		type = JSON_TOK_FALSE;
+	} else if (strcmp(tok, "null") == 0) {
+		type = JSON_TOK_NULL;
+#ifdef CONFIG_JSON_LIBRARY_FP_SUPPORT
+	} else if (strcmp(tok, "NaN") == 0 || strcmp(tok, "Infinity") == 0 ||
+		   strcmp(tok, "-Infinity") == 0) {
+		type = JSON_TOK_NUMBER;
+#endif
+	} else if ((isdigit((unsigned char)tok[0]) != 0 ||
+		    (tok[0] == '-' && isdigit((unsigned char)tok[1]) != 0)) &&
+		   strspn(tok, "0123456789.e+-") == stream->tok_len) {
+		type = JSON_TOK_NUMBER;
+	} else {
+		return -EINVAL;
+	}
+
+	if (stream->skip > 0) {
+		return 0;
+	}
+
+	return stream_scalar(stream, type);
+}
+
+static bool stream_literal_char(char chr)
+{
+	return isalnum((unsigned char)chr) != 0 || chr == '.' || chr == '+' || chr == '-';
+}
+
+static void stream_tok_add(struct json_obj_stream *stream, char chr)
+{
+	if (stream->tok_len < CONFIG_JSON_LIBRARY_STREAM_TOKEN_SIZE) {
+		stream->tok[stream->tok_len++] = chr;
+	} else {
+		stream->tok_overflow = true;
+	}
+}
+
+static int stream_char(struct json_obj_stream *stream, char chr)
+{
+	int ret;
+
+	switch (stream->lex) {
+	case STREAM_LEX_ESCAPE:
+		if (chr == '\0' || strchr("\"\\/bfnrtu", chr) == NULL) {
+			return -EINVAL;
+		}
+
+		stream->lex = STREAM_LEX_STRING;
+		stream_tok_add(stream, chr);
+		return 0;
+	case STREAM_LEX_STRING:
+		if (chr == '"') {
+			stream->lex = STREAM_LEX_NONE;
+			return stream_string(stream);
+		}
+
+		if (chr == '\\') {
+			stream->lex = STREAM_LEX_ESCAPE;
+		}
+
+		stream_tok_add(stream, chr);
+		return 0;
+	case STREAM_LEX_LITERAL:
+		if (stream_literal_char(chr)) {
+			stream_tok_add(stream, chr);
+			return 0;
+		}
+
+		stream->lex = STREAM_LEX_NONE;
+		ret = stream_literal(stream);
+		if (ret < 0) {
+			return ret;
+		}
+		break;
+	default:
+		break;
+	}
+
+	if (isspace((unsigned char)chr) != 0) {
+		return 0;
+	}
+
+	if (chr == '"' || stream_literal_char(chr)) {
+		stream->lex = (chr == '"') ? STREAM_LEX_STRING : STREAM_LEX_LITERAL;
+		stream->tok_len = 0;
+		stream->tok_overflow = false;
+		if (chr != '"') {
+			stream_tok_add(stream, chr);
+		}
+		return 0;
+	}
+
+	return stream_punct(stream, chr);
+}
+
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->result) * CHAR_BIT - 1));
+
+	stream->frames[0].descr = descr;
+	stream->frames[0].descr_len = descr_len;
+	stream->frames[0].val = val;
+	stream->frames[0].decoded = 0;
+	stream->frames[0].field = descr_len;
+	stream->frames[0].array = false;
+	stream->result = 0;
+	stream->depth = 0;
+	stream->expect = STREAM_EXPECT_OBJECT;
+	stream->lex = STREAM_LEX_NONE;
+	stream->skip = 0;
+	stream->tok_len = 0;
+	stream->tok_overflow = false;
+}
+
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len)
+{
+	for (size_t i = 0; i < len && stream->result >= 0; i++) {
+		if (stream->expect == STREAM_EXPECT_NOTHING) {
+			break;
+		}
+
+		int ret = stream_char(stream, data[i]);
+
+		if (ret < 0) {
+			stream->result = ret;
+		}
+	}
+
+	return (stream->result < 0) ? (int)stream->result : 0;
+}
+
+int64_t json_obj_stream_finish(struct json_obj_stream *stream)
+{
+	if (stream->result < 0) {
+		return stream->result;
+	}
+
+	if (stream->expect != STREAM_EXPECT_NOTHING) {
+		return -EINVAL;
+	}
+
+	return stream->result;
+}
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
@@ -0,0 +1,88 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/sys/ring_buffer_spsc.h>
+
+/*
+ * Copy between the claimed areas of a ring buffer and the areas of the
+ * caller, up to the claimed size, and return the number of bytes copied.
+ */
+static uint32_t vec_copy(const struct ring_buf_spsc_vec area[2], uint32_t claimed,
+			 const struct ring_buf_spsc_vec *vec, size_t vec_cnt, bool put)
+{
+	size_t a = 0;
+	uint32_t area_off = 0;
+	uint32_t total = 0;
+
+	for (size_t i = 0; i < vec_cnt && total < claimed; i++) {
+		uint8_t *data = vec[i].data;
+		uint32_t len = MIN(vec[i].len, claimed - total);
+
+		total += len;
+
+		while (len > 0) {
+			uint32_t n = MIN(len, area[a].len - area_off);
+			uint8_t *ring = &area[a].data[area_off];
+
+			if (put) {
+				memcpy(ring, data, n);
+			} else if (data != NULL) {
+				memcpy(data, ring, n);
+			}
+
+			if (data != NULL) {
+				data += n;
+			}
+
+			len -= n;
+			area_off += n;
+			if (area_off == area[a].len) {
+				a++;
+				area_off = 0;
+			}
+		}
+	}
+
+	return total;
+}
+
+uint32_t ring_buf_spsc_putv(struct ring_buf_spsc *rb, const struct ring_buf_spsc_vec *vec,
+			    size_t vec_cnt)
+{
+	struct ring_buf_spsc_vec area[2];
+	uint32_t claimed;
+	uint32_t total;
+	int err;
+
+	claimed = ring_buf_spsc_put_claim(rb, area, UINT32_MAX);
+	total = vec_copy(area, claimed, vec, vec_cnt, true);
+
+	err = ring_buf_spsc_put_finish(rb, total);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	return total;
+}
+
+uint32_t ring_buf_spsc_getv(struct ring_buf_spsc *rb, const struct ring_buf_spsc_vec *vec,
+			    size_t vec_cnt)
+{
+	struct ring_buf_spsc_vec area[2];
+	uint32_t claimed;
+	uint32_t total;
+	int err;
+
+	claimed = ring_buf_spsc_get_claim(rb, area, UINT32_MAX);
+	total = vec_copy(area, claimed, vec, vec_cnt, false);
+
+	err = ring_buf_spsc_get_finish(rb, total);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+
+	return total;
+}
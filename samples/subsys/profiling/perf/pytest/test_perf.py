@@ -6,6 +6,7 @@
 
 import logging
 import re
+import time
 
 from twister_harness import DeviceAdapter, Shell
 
@@ -36,3 +37,44 @@ def test_shell_perf(dut: DeviceAdapter, shell: Shell):
     while i < length:
         i += int(lines[i], 16) + 1
         assert i <= length, 'one of the samples is not true to size'
+
+
+def test_shell_perf_folded(dut: DeviceAdapter, shell: Shell):
+
+    shell.base_timeout=10
+
+    logger.info('send "perf record 0 99" command')
+    lines = shell.exec_command('perf record 0 99')
+    assert 'Enabled perf' in lines, 'expected response not found'
+    time.sleep(1)
+
+    logger.info('send "perf stop" command')
+    lines = shell.exec_command('perf stop')
+    if not any('Perf done!' in line for line in lines):
+        dut.readlines_until(regex='.*Perf done!', print_output=True)
+    logger.info('response is valid')
+
+    logger.info('send "perf folded" command')
+    lines = shell.exec_command('perf folded')
+    header = [i for i, line in enumerate(lines) if line.startswith('Perf folded stacks')]
+    assert header, 'expected response not found'
+    lines = lines[header[0]:]
+    match = re.match(r"Perf folded stacks (\d+)", lines[0])
+    assert match is not None, 'expected response not found'
+    count = int(match.group(1))
+    stacks = lines[1:count + 1]
+    assert count != 0, 'no stack recorded'
+    assert count == len(stacks), 'count does not match with count of stacks'
+
+    samples = 0
+    for line in stacks:
+        match = re.match(r"(\S+) (\d+)$", line)
+        assert match is not None, f'"{line}" is not in folded format'
+        assert all(match.group(1).split(';')), f'"{line}" has an empty frame'
+        samples += int(match.group(2))
+    assert samples != 0, 'no sample counted'
+    assert any('func_' in line for line in stacks), 'sample functions not resolved'
+
+    logger.info('check that the stacks were cleared')
+    lines = shell.exec_command('perf folded')
+    assert 'Perf folded stacks 0' in lines, 'stacks not cleared'
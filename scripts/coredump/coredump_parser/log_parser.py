@@ -4,6 +4,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0
 
+import io
 import logging
 import struct
 
@@ -12,6 +13,7 @@ COREDUMP_HDR_ID = b'ZE'
 COREDUMP_HDR_VER = 2
 LOG_HDR_STRUCT = "<ccHHBBI"
 LOG_HDR_SIZE = struct.calcsize(LOG_HDR_STRUCT)
+COREDUMP_HDR_FLAG_COMPRESSED = 0x01
 
 COREDUMP_ARCH_HDR_ID = b'A'
 LOG_ARCH_HDR_STRUCT = "<cHH"
@@ -48,6 +50,47 @@ def reason_string(reason):
     return ret
 
 
+def decompress(data):
+    """
+    Decompress the output of subsys/debug/coredump/coredump_compress.c.
+
+    Each token starts with a control byte: below 0x80, a run of
+    (control + 1) literal bytes follows; otherwise, this is a match of
+    ((control & 0x7F) + 3) bytes starting at the 16-bit little endian
+    distance which follows. Matches may overlap their own output.
+    """
+    out = bytearray()
+    idx = 0
+
+    while idx < len(data):
+        ctrl = data[idx]
+        idx += 1
+
+        if ctrl < 0x80:
+            count = ctrl + 1
+            if idx + count > len(data):
+                raise ValueError("Truncated literal run")
+            out += data[idx : idx + count]
+            idx += count
+            continue
+
+        if idx + 2 > len(data):
+            raise ValueError("Truncated match")
+
+        length = (ctrl & 0x7F) + 3
+        dist = data[idx] | (data[idx + 1] << 8)
+        idx += 2
+
+        if dist == 0 or dist > len(out):
+            raise ValueError(f"Invalid match distance {dist}")
+
+        start = len(out) - dist
+        for i in range(length):
+            out.append(out[start + i])
+
+    return bytes(out)
+
+
 class CoredumpLogFile:
     """
     Process the binary coredump file for register block
@@ -158,6 +201,18 @@ class CoredumpLogFile:
         logger.info(f"Reason: {reason_string(reason)}")
         logger.info(f"Pointer size {ptr_size}")
 
+        if flags & COREDUMP_HDR_FLAG_COMPRESSED:
+            try:
+                data = decompress(self.fd.read())
+            except ValueError as e:
+                logger.error(f"Cannot decompress coredump: {e}")
+                return False
+
+            logger.info(f"Decompressed coredump to {len(data)} bytes")
+
+            self.fd.close()
+            self.fd = io.BytesIO(data)
+
         del id1, id2, hdr_ver, tgt_code, ptr_size, flags, reason
 
         while True:
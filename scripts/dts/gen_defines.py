@@ -107,6 +107,7 @@ def main():
 
         write_chosen(edt)
         write_global_macros(edt)
+        write_device_name_hash(edt)
 
 
 def node_z_path_id(node: edtlib.Node) -> str:
@@ -1085,6 +1086,82 @@ def write_global_macros(edt: edtlib.EDT):
                 f"DT_COMPAT_{str2ident(compat)}_BUS_{str2ident(bus)}", 1)
 
 
+def device_name_hash(name: bytes, seed: int) -> int:
+    # Must match device_name_hash() in kernel/device.c: 32-bit FNV-1a
+    # with the seed mixed into the offset basis, high bits folded in.
+
+    h = 0x811c9dc5 ^ seed
+    for c in name:
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    return h ^ (h >> 16)
+
+
+def write_device_name_hash(edt: edtlib.EDT):
+    # Writes a perfect hash of the names of the "okay" nodes with a
+    # compatible, which are the ones that may have a device. This lets
+    # device_get_binding() find them without comparing the name of every
+    # device. The name must be the one DEVICE_DT_NAME() gives.
+    #
+    # The hash is two-level ("hash and displace"): the name is hashed a
+    # first time with seed 0 to select a seed, and a second time with that
+    # seed to select its slot. Table sizes are powers of two with a load
+    # factor of at most 1/2, so suitable seeds are found quickly.
+
+    names = defaultdict(list)
+    for node in edt.nodes:
+        if node.status != "okay" or not node.compats:
+            continue
+        if "label" in node.props:
+            name = node.props["label"].val
+        else:
+            name = node.name
+        names[name.encode("utf-8")].append(node)
+
+    # A name shared by several nodes is left to the linear search, which
+    # keeps returning the first device in link order.
+    keys = sorted(name for name, nodes in names.items() if len(nodes) == 1)
+
+    size = 2
+    while size < 2 * len(keys):
+        size *= 2
+
+    while True:
+        seeds = [0] * size
+        slots = [None] * size
+
+        buckets = defaultdict(list)
+        for key in keys:
+            buckets[device_name_hash(key, 0) % size].append(key)
+
+        for bucket, bucket_keys in sorted(buckets.items(),
+                                          key=lambda b: (-len(b[1]), b[0])):
+            for seed in range(256):
+                taken = [device_name_hash(key, seed) % size
+                         for key in bucket_keys]
+                if (len(set(taken)) == len(taken) and
+                        all(slots[slot] is None for slot in taken)):
+                    break
+            else:
+                break
+
+            seeds[bucket] = seed
+            for key, slot in zip(bucket_keys, taken):
+                slots[slot] = names[key][0]
+        else:
+            break
+
+        size *= 2
+
+    out_comment("Perfect hash of the device names of \"okay\" nodes, see "
+                "device_get_binding()")
+    out_dt_define("DEVICE_NAME_HASH_SIZE", size)
+    out_dt_define("DEVICE_NAME_HASH_SEEDS", list2init(str(seed) for seed in seeds))
+    out_dt_define("FOREACH_DEVICE_NAME_HASH_SLOT(fn)",
+                  " ".join(f"fn(DT_{node.z_path_id}, {slot})"
+                           for slot, node in enumerate(slots)
+                           if node is not None))
+
+
 def str2ident(s: str) -> str:
     # Converts 's' to a form suitable for (part of) an identifier
 
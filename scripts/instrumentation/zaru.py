@@ -27,6 +27,7 @@ import re
 import shutil
 import subprocess
 import tempfile
+import time
 
 import serial
 from colorama import Fore, Style
@@ -51,6 +52,12 @@ CTF_METADATA = "ctf_metadata"
 OBJDUMP_CMD = ["objdump", "-t"]
 
 
+NM_CMD = ["nm", "-S", "-l", "--defined-only"]
+
+
+NM_PATTERN = r"([0-9A-Fa-f]+)\s([0-9A-Fa-f]+)\s[tTwW]\s(\S+)\s*(\S*)"
+
+
 CPPFILT_CMD = ["c++filt"]
 
 
@@ -103,6 +110,90 @@ def get_symbols_from_elf(elf_file, verbose=False):
     return addr_to_symbol
 
 
+def get_function_ranges_from_elf(elf_file, verbose=False):
+    """Get function address ranges from ELF.
+
+    Get functions from a given 'elf_file' file and return them as a list of
+    (start, end, symbol, source file) tuples, 'end' being exclusive.
+    """
+
+    assert elf_file.exists(), f"File '{elf_file}' does not exist!"
+
+    cmd = NM_CMD + [elf_file]
+
+    try:
+        output = subprocess.check_output(cmd, text=True)
+    except subprocess.CalledProcessError:
+        cmd = " ".join(str(c) for c in cmd)
+        print(f"'{cmd}' failed execution. Check if it is properly installed.")
+        sys.exit(2)
+    except FileNotFoundError:
+        print(f"Could not find executable '{NM_CMD[0]}'. Please install it.")
+        sys.exit(3)
+
+    if verbose:
+        print(f"Reading function ranges from '{pathlib.Path(elf_file).resolve()}'.")
+
+    r = re.compile(NM_PATTERN)
+    ranges = []
+    for line in output.split("\n"):
+        m = r.match(line)
+        if m is None:
+            continue
+
+        start = int(m.group(1), 16)
+        size = int(m.group(2), 16)
+        if size == 0:
+            continue
+
+        # Source location is 'file:line'
+        ranges.append((start, start + size, m.group(3), m.group(4).rsplit(":", 1)[0]))
+
+    return ranges
+
+
+def set_profile_filters(port, elf, args, verbose=False):
+    """Set runtime include and exclude filters in the target.
+
+    Functions are selected by symbol name or by a substring of their source
+    file path. Profile info collected so far is cleared once filters are set.
+    Returns 'False' if a given symbol or file doesn't match any function.
+    """
+
+    filters = [(sym, "symbol", "include") for sym in args.include or []]
+    filters += [(sym, "symbol", "exclude") for sym in args.exclude or []]
+    filters += [(f, "file", "include") for f in args.include_file or []]
+    filters += [(f, "file", "exclude") for f in args.exclude_file or []]
+
+    if not filters:
+        return True
+
+    ranges = get_function_ranges_from_elf(elf, verbose)
+
+    port.write(b'filter_clear\r')
+
+    for pattern, kind, action in filters:
+        if kind == "symbol":
+            matches = [(s, e) for s, e, sym, _ in ranges if sym == pattern]
+        else:
+            matches = [(s, e) for s, e, _, f in ranges if pattern in f]
+
+        if not matches:
+            print(Fore.RED + f"No function found for {kind} '{pattern}'.")
+            return False
+
+        for start, end in matches:
+            if verbose:
+                print(f"{action} {start:08x}-{end:08x} ({pattern})")
+            port.write(bytes(f"{action} {start:x} {end:x}\r", "ascii"))
+            # Target processes commands one at a time.
+            time.sleep(0.01)
+
+    port.write(b'profile_reset\r')
+
+    return True
+
+
 def generate_reverse_symbol_lookup(addr_to_symbol):
     """Generate a reverse symbol lookup dict.
 
@@ -971,10 +1062,12 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
     This function uses 'port' to get the binary stream from target and 'elf'
     file to resolve the symbols and then prints the profile info in it. The
     binary stream is interpreted according to the CTF (Common Trace Format) file
-    'metadata', using library babeltrece2.
+    'metadata', using library babeltrece2. The target sorts the functions and
+    only sends the 'n' most expensive ones.
     """
 
-    port.write(b'dump_profile\r')
+    inclusive = args.sort == "incl"
+    port.write(bytes(f"dump_stats {max(n, 0)} {args.sort}\r", "ascii"))
 
     # See comment above in get_and_print_trace() about CTF and babeltrace2
     # caveats.
@@ -997,32 +1090,35 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
         symbols = get_symbols_from_elf(elf, verbose)
 
         profiles = []
-        acc_delta_t = 0
         for msg in msg_it:
             if isinstance(msg, bt2._EventMessageConst):
                 event = msg.event
 
-                # Profile events have always ID = 2. This value is defined first
-                # by enum instr_event_types, in instrumentation.h, then it is
-                # defined accordingly in ctf/metadata.
-                if event.id == 2:
+                # Profile stats events have always ID = 5. This value is defined
+                # first by enum instr_event_types, in instrumentation.h, then it
+                # is defined accordingly in ctf/metadata.
+                if event.id == 5:
                     callee = event.payload_field.get("callee").real
-                    delta_t = event.payload_field.get("delta_t").real
+                    calls = event.payload_field.get("calls").real
+                    incl_t = event.payload_field.get("incl_t").real
+                    excl_t = event.payload_field.get("excl_t").real
 
-                    profiles.append((callee, delta_t))
-                    acc_delta_t = acc_delta_t + delta_t
+                    profiles.append((callee, calls, incl_t, excl_t))
 
-        # Sort by delta_t
-        profiles.sort(key=lambda t: t[1], reverse=True)
+        # Already sorted by the target, percentages are relative to the most
+        # expensive function in inclusive mode, usually the trigger function.
+        total_t = max((p[2] for p in profiles), default=0)
 
-        if n > 0:
-            N = n
-        else:
-            N = len(profiles)
+        print(
+            "time %".rjust(7),
+            "calls".rjust(10),
+            "incl (ns)".rjust(14),
+            "excl (ns)".rjust(14),
+            "avg (ns)".rjust(10),
+            " function",
+        )
 
-        for i, (callee, delta_t) in enumerate(profiles):
-            if i == N:
-                break
+        for callee, calls, incl_t, excl_t in profiles:
             callee = f'{callee:08x}'
             callee_symbol = symbols.get(callee)
 
@@ -1033,7 +1129,8 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
                 )
                 continue
 
-            percent_delta_t = (delta_t / acc_delta_t) * 100
+            delta_t = incl_t if inclusive else excl_t
+            percent_delta_t = (delta_t / total_t) * 100 if total_t else 0
             # Threshold set to greater than 22 % to show in red color.
             if percent_delta_t > 22:
                 color = Fore.LIGHTGREEN_EX
@@ -1041,7 +1138,11 @@ def get_and_print_profile(args, port, elf, n, verbose=False):
                 color = Fore.GREEN
 
             print(
-                color + (f'{percent_delta_t:.2f}' + "%").rjust(6),
+                color + (f'{percent_delta_t:.2f}' + "%").rjust(7),
+                f'{calls}'.rjust(10),
+                f'{incl_t}'.rjust(14),
+                f'{excl_t}'.rjust(14),
+                f'{delta_t // calls if calls else 0}'.rjust(10),
                 callee,
                 callee_symbol.ljust(20),
                 Fore.WHITE,
@@ -1200,6 +1301,13 @@ def profile(args):
         sys.exit(1)
 
     elf_file = get_elf_file(args, args.verbose)
+
+    if not set_profile_filters(sport, elf_file, args, args.verbose):
+        sys.exit(1)
+
+    if args.wait > 0:
+        time.sleep(args.wait)
+
     num_profiles = get_and_print_profile(args, sport, elf_file, args.n, args.verbose)
     if num_profiles == 0:
         print_message_on_empty_buffer("profile")
@@ -1307,6 +1415,43 @@ if __name__ == "__main__":
     profile_parser.add_argument(
         '-n', nargs='?', type=int, default=100, help="show first N most expensive functions."
     )
+    profile_parser.add_argument(
+        '--sort',
+        choices=["excl", "incl"],
+        default="excl",
+        help="sort by exclusive (callees not included) or inclusive time. Default to 'excl'.",
+    )
+    profile_parser.add_argument(
+        '--include',
+        metavar="FUNC_NAME",
+        action='append',
+        help="only profile FUNC_NAME, and other included functions. Can be repeated.",
+    )
+    profile_parser.add_argument(
+        '--exclude',
+        metavar="FUNC_NAME",
+        action='append',
+        help="don't profile FUNC_NAME. Can be repeated.",
+    )
+    profile_parser.add_argument(
+        '--include-file',
+        metavar="FILE",
+        action='append',
+        help="only profile functions from source files matching FILE. Can be repeated.",
+    )
+    profile_parser.add_argument(
+        '--exclude-file',
+        metavar="FILE",
+        action='append',
+        help="don't profile functions from source files matching FILE. Can be repeated.",
+    )
+    profile_parser.add_argument(
+        '--wait',
+        '-w',
+        type=float,
+        default=0,
+        help="seconds to wait before getting profile info, e.g. after setting filters.",
+    )
     profile_parser.set_defaults(func=profile)
 
     args = parser.parse_args()
@@ -17,6 +17,7 @@ import contextlib
 import logging
 import os
 import select
+import socket
 import sys
 import time
 
@@ -148,6 +149,74 @@ class JLinkRTTReader:
         return bytes(self.jlink.rtt_read(self.channel, 1024))
 
 
+class UdpReader:
+    """Class to read data sent by the network log backend over UDP"""
+
+    def __init__(self, address, port):
+        self.address = address
+        self.port = port
+        self.sock = None
+
+    @contextlib.contextmanager
+    def open(self):
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+            sock.bind((self.address, self.port))
+            self.sock = sock
+            yield
+
+    def fileno(self):
+        return self.sock.fileno()
+
+    def read_non_blocking(self):
+        # Each datagram carries one complete log message
+        return self.sock.recv(65535)
+
+
+class TcpReader:
+    """Class to read data sent by the network log backend over TCP"""
+
+    def __init__(self, address, port):
+        self.address = address
+        self.port = port
+        self.conn = None
+        self.pending = b''
+
+    @contextlib.contextmanager
+    def open(self):
+        with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as sock:
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+            sock.bind((self.address, self.port))
+            sock.listen(1)
+            conn, _ = sock.accept()
+            with conn:
+                self.conn = conn
+                yield
+
+    def fileno(self):
+        return self.conn.fileno()
+
+    def read_non_blocking(self):
+        data = self.conn.recv(65535)
+        if not data:
+            raise EOFError("Connection closed by the device")
+
+        # Frames are prefixed with their length in ASCII followed by a space
+        # (octet counting, RFC 6587), strip it and return complete frames only.
+        self.pending += data
+        out = b''
+        while True:
+            sep = self.pending.find(b' ')
+            if sep < 0:
+                break
+            length = int(self.pending[:sep])
+            if len(self.pending) < sep + 1 + length:
+                break
+            out += self.pending[sep + 1 : sep + 1 + length]
+            self.pending = self.pending[sep + 1 + length :]
+
+        return out
+
+
 def parse_args():
     """Parse command line arguments"""
     parser = argparse.ArgumentParser(allow_abbrev=False)
@@ -187,6 +256,14 @@ def parse_args():
     jlink_rtt_parser.add_argument("--speed", type=int, help="Reading speed", default='0')
     jlink_rtt_parser.add_argument("--lib-path", help="Path to libjlinkarm.so library")
 
+    # Network subparsers
+    for proto in ("udp", "tcp"):
+        net_parser = subparsers.add_parser(
+            proto, help=f"Receive from the network log backend over {proto.upper()}"
+        )
+        net_parser.add_argument("port", type=int, help="Port to listen on")
+        net_parser.add_argument("--address", default="0.0.0.0", help="Address to listen on")
+
     return parser.parse_args()
 
 
@@ -217,6 +294,10 @@ def main():
         reader = JLinkRTTReader(
             args.target_device, args.block_address, args.channel, args.speed, args.lib_path
         )
+    elif args.mode == "udp":
+        reader = UdpReader(args.address, args.port)
+    elif args.mode == "tcp":
+        reader = TcpReader(args.address, args.port)
     else:
         raise ValueError("Invalid mode selected. Use 'serial' or 'file'.")
 
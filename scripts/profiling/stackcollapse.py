@@ -12,8 +12,11 @@ This translate stack samples captured by perf subsystem into format
 used by flamegraph.pl. Translation uses .elf file to get function names
 from addresses
 
+The output of "perf folded" is accepted as well, in which case the
+addresses left unresolved on the target are translated.
+
 Usage:
-    ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+    ./script/perf/stackcollapse.py <file with perf printbuf/folded output> <ELF file>
 """
 
 import re
@@ -54,12 +57,31 @@ def collapse(buf, elf):
         buf = buf[8 + 8 * count:]
 
 
+def resolve_folded(lines, elf):
+    for line in lines:
+        trace, count = line.rsplit(" ", 1)
+        funcs = []
+        for frame in trace.split(";"):
+            func = addr_to_sym(int(frame, 16), elf) if frame.startswith("0x") else frame
+            # merge dublicate functions
+            if not funcs or funcs[-1] != func:
+                funcs.append(func)
+
+        print(";".join(funcs), count)
+
+
 if __name__ == "__main__":
     elf = ELFFile(open(sys.argv[2], "rb"))
     with open(sys.argv[1], "r") as f:
         inp = f.read()
 
     lines = inp.splitlines()
+    match = re.match(r"Perf folded stacks (\d+)", lines[0])
+    if match:
+        assert int(match.group(1)) == len(lines) - 1
+        resolve_folded(lines[1:], elf)
+        sys.exit(0)
+
     assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
     buf = binascii.unhexlify("".join(lines[1:]))
     collapse(buf, elf)
@@ -0,0 +1,59 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_CRC_CRC32_SLICING_H_
+#define ZEPHYR_SUBSYS_CRC_CRC32_SLICING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_SW_SLICE_BY_8)
+#define CRC32_SLICES 8
+#elif defined(CONFIG_CRC32_SW_SLICE_BY_4)
+#define CRC32_SLICES 4
+#endif
+
+#ifdef CRC32_SLICES
+
+/*
+ * Slicing-by-4/8 update of a reflected 32-bit CRC, without the initial and
+ * final inversions.
+ *
+ * table[0] is the usual byte-wise table of the polynomial and table[k][n]
+ * the CRC of byte n followed by k zero bytes, so the bytes of a 4 or 8 byte
+ * word can be looked up independently and their contributions combined.
+ */
+static inline uint32_t crc32_slicing_update(const uint32_t table[CRC32_SLICES][256], uint32_t crc,
+					    const uint8_t *data, size_t len)
+{
+	for (; len >= CRC32_SLICES; len -= CRC32_SLICES, data += CRC32_SLICES) {
+		uint32_t word = sys_get_le32(data) ^ crc;
+
+#if CRC32_SLICES == 8
+		uint32_t next = sys_get_le32(data + 4);
+
+		crc = table[7][word & 0xff] ^ table[6][(word >> 8) & 0xff] ^
+		      table[5][(word >> 16) & 0xff] ^ table[4][word >> 24] ^
+		      table[3][next & 0xff] ^ table[2][(next >> 8) & 0xff] ^
+		      table[1][(next >> 16) & 0xff] ^ table[0][next >> 24];
+#else
+		crc = table[3][word & 0xff] ^ table[2][(word >> 8) & 0xff] ^
+		      table[1][(word >> 16) & 0xff] ^ table[0][word >> 24];
+#endif
+	}
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* CRC32_SLICES */
+
+#endif /* ZEPHYR_SUBSYS_CRC_CRC32_SLICING_H_ */
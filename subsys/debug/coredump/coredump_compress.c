@@ -0,0 +1,185 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Streaming LZ77 compression of the coredump output.
+ *
+ * The compressed stream is a sequence of tokens, each starting with a
+ * control byte:
+ * - 0x00-0x7F: literal run, followed by (control + 1) bytes.
+ * - 0x80-0xFF: match of ((control & 0x7F) + MIN_MATCH) bytes, followed by
+ *   the 16-bit little endian distance back to the start of the match.
+ *   A match may overlap the bytes it produces, which is how runs of a
+ *   repeated byte (e.g. zeroed memory) are encoded.
+ *
+ * This runs from the fatal error path, so all the state is static and
+ * the input is only kept in a ring buffer the size of the window.
+ */
+
+#include <string.h>
+
+#include <zephyr/debug/coredump.h>
+#include <zephyr/sys/util.h>
+
+#include "coredump_internal.h"
+
+#define WINDOW_SIZE  CONFIG_DEBUG_COREDUMP_COMPRESSION_WINDOW_SIZE
+#define WINDOW_MASK  (WINDOW_SIZE - 1)
+#define HASH_BITS    CONFIG_DEBUG_COREDUMP_COMPRESSION_HASH_BITS
+#define MIN_MATCH    3
+#define MAX_MATCH    (0x7F + MIN_MATCH)
+#define MAX_LITERALS 0x80
+#define MAX_DISTANCE (WINDOW_SIZE - MAX_MATCH)
+#define OUT_SIZE     64
+
+BUILD_ASSERT(IS_POWER_OF_TWO(WINDOW_SIZE), "Window size must be a power of two");
+/* Pending literals are read back from the window when flushed */
+BUILD_ASSERT(WINDOW_SIZE > MAX_MATCH + MAX_LITERALS);
+
+static struct {
+	coredump_backend_buffer_output_t output;
+
+	/* Number of bytes received */
+	uint32_t pos;
+
+	/* Number of bytes encoded, including pending literals */
+	uint32_t done;
+
+	/* Number of literals waiting to be emitted, ending at done */
+	uint32_t lit_len;
+
+	/* Position + 1 of the last occurrence of each hash, 0 if none */
+	uint32_t head[BIT(HASH_BITS)];
+
+	uint8_t window[WINDOW_SIZE];
+
+	uint8_t out[OUT_SIZE];
+	size_t out_len;
+} cz;
+
+static void out_put(uint8_t byte)
+{
+	cz.out[cz.out_len++] = byte;
+
+	if (cz.out_len == sizeof(cz.out)) {
+		cz.output(cz.out, cz.out_len);
+		cz.out_len = 0;
+	}
+}
+
+static inline uint8_t window_at(uint32_t p)
+{
+	return cz.window[p & WINDOW_MASK];
+}
+
+static inline uint32_t hash_at(uint32_t p)
+{
+	uint32_t v = window_at(p) | (window_at(p + 1) << 8) | (window_at(p + 2) << 16);
+
+	return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+static void literals_flush(void)
+{
+	if (cz.lit_len == 0) {
+		return;
+	}
+
+	out_put(cz.lit_len - 1);
+
+	for (uint32_t p = cz.done - cz.lit_len; p != cz.done; p++) {
+		out_put(window_at(p));
+	}
+
+	cz.lit_len = 0;
+}
+
+/* Encode the token starting at cz.done */
+static void encode_step(void)
+{
+	uint32_t avail = cz.pos - cz.done;
+	uint32_t len = 0;
+	uint32_t dist = 0;
+
+	if (avail >= MIN_MATCH) {
+		uint32_t h = hash_at(cz.done);
+		uint32_t cand = cz.head[h];
+
+		cz.head[h] = cz.done + 1;
+
+		if ((cand != 0) && ((cz.done - (cand - 1)) <= MAX_DISTANCE)) {
+			uint32_t max = MIN(avail, MAX_MATCH);
+
+			cand--;
+			while ((len < max) && (window_at(cand + len) == window_at(cz.done + len))) {
+				len++;
+			}
+			dist = cz.done - cand;
+		}
+	}
+
+	if (len < MIN_MATCH) {
+		cz.done++;
+		cz.lit_len++;
+		if (cz.lit_len == MAX_LITERALS) {
+			literals_flush();
+		}
+		return;
+	}
+
+	literals_flush();
+	out_put(0x80 | (len - MIN_MATCH));
+	out_put(dist & 0xFF);
+	out_put(dist >> 8);
+
+	/* Index the positions covered by the match for the next ones */
+	for (uint32_t i = 1; i < len; i++) {
+		uint32_t p = cz.done + i;
+
+		if ((cz.pos - p) >= MIN_MATCH) {
+			cz.head[hash_at(p)] = p + 1;
+		}
+	}
+
+	cz.done += len;
+}
+
+void z_coredump_compress_start(coredump_backend_buffer_output_t output)
+{
+	cz.output = output;
+	cz.pos = 0;
+	cz.done = 0;
+	cz.lit_len = 0;
+	cz.out_len = 0;
+	(void)memset(cz.head, 0, sizeof(cz.head));
+}
+
+void z_coredump_compress_output(const uint8_t *buf, size_t buflen)
+{
+	for (size_t i = 0; i < buflen; i++) {
+		cz.window[cz.pos & WINDOW_MASK] = buf[i];
+		cz.pos++;
+
+		/* Keep a full match of lookahead */
+		if ((cz.pos - cz.done) == MAX_MATCH) {
+			encode_step();
+		}
+	}
+}
+
+void z_coredump_compress_end(void)
+{
+	while (cz.done != cz.pos) {
+		encode_step();
+	}
+
+	literals_flush();
+
+	if (cz.out_len != 0) {
+		cz.output(cz.out, cz.out_len);
+		cz.out_len = 0;
+	}
+}
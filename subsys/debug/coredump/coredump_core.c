@@ -9,6 +9,7 @@
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/util.h>
 
 #include "coredump_internal.h"
@@ -72,6 +73,10 @@ static void dump_header(unsigned int reason)
 		.reason = sys_cpu_to_le16(reason),
 	};
 
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESSION)) {
+		hdr.flag |= COREDUMP_HDR_FLAG_COMPRESSED;
+	}
+
 	if (sizeof(uintptr_t) == 8) {
 		hdr.ptr_size_bits = 6; /* 2^6 = 64 */
 	} else if (sizeof(uintptr_t) == 4) {
@@ -86,7 +91,8 @@ static void dump_header(unsigned int reason)
 }
 
 #if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) ||                                              \
-	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS)
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS) ||                                      \
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_SELECTIVE)
 
 static inline void select_stack_region(const struct k_thread *thread, bool is_current,
 				       uintptr_t *start, uintptr_t *end)
@@ -143,6 +149,15 @@ static void dump_thread(struct k_thread *thread, bool is_current)
 }
 #endif
 
+static void dump_registered_regions(void)
+{
+	STRUCT_SECTION_FOREACH(coredump_memory_region, r) {
+		uintptr_t start_addr = POINTER_TO_UINT(r->start);
+
+		coredump_memory_dump(start_addr, start_addr + r->size);
+	}
+}
+
 #if defined(CONFIG_COREDUMP_DEVICE)
 static void process_coredump_dev_memory(const struct device *dev)
 {
@@ -225,11 +240,20 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 #endif
 
 	if (thread != NULL) {
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) ||                                              \
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_SELECTIVE)
 		dump_thread(thread, /* is_current */ true);
 #endif
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_SELECTIVE
+	coredump_memory_dump(POINTER_TO_UINT(&_kernel),
+			     POINTER_TO_UINT(&_kernel) + sizeof(_kernel));
+#endif
+
+	/* Before the bulk of memory, in case the backend runs out of space */
+	dump_registered_regions();
+
 	process_memory_region_list(thread);
 
 	z_coredump_end();
@@ -238,10 +262,18 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 void z_coredump_start(void)
 {
 	backend_api->start();
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	z_coredump_compress_start(backend_api->buffer_output);
+#endif
 }
 
 void z_coredump_end(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	z_coredump_compress_end();
+#endif
+
 	backend_api->end();
 }
 
@@ -252,7 +284,11 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 		return;
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	z_coredump_compress_output(buf, buflen);
+#else
 	backend_api->buffer_output(buf, buflen);
+#endif
 }
 
 void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
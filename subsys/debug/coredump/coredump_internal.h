@@ -8,6 +8,7 @@
 #define DEBUG_COREDUMP_INTERNAL_H_
 
 #include <zephyr/toolchain.h>
+#include <zephyr/debug/coredump.h>
 
 /**
  * @cond INTERNAL_HIDDEN
@@ -43,6 +44,33 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+/**
+ * @brief Start a compressed stream
+ *
+ * @param output Function receiving the compressed data
+ */
+void z_coredump_compress_start(coredump_backend_buffer_output_t output);
+
+/**
+ * @brief Compress data
+ *
+ * Compressed data is handed to the output function as it becomes
+ * available.
+ *
+ * @param buf Data to compress
+ * @param buflen Length of the data
+ */
+void z_coredump_compress_output(const uint8_t *buf, size_t buflen);
+
+/**
+ * @brief Flush the compressed stream
+ *
+ * Encodes the remaining data and outputs everything left.
+ */
+void z_coredump_compress_end(void);
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESSION */
+
 /**
  * @endcond
  */
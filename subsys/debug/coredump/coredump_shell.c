@@ -357,6 +357,14 @@ static int parse_and_print_coredump(const struct shell *sh,
 
 		*coredump_header = true;
 
+		if ((ret > 0) &&
+		    ((((struct coredump_hdr_t *)copy->buffer)->flag &
+		      COREDUMP_HDR_FLAG_COMPRESSED) != 0)) {
+			/* Blocks cannot be parsed, print the rest as is */
+			shell_print(sh, "-> Compressed coredump, use the host tools to decode");
+			data_size = left_size - copy->length;
+		}
+
 		goto hdr_done;
 	}
 
@@ -162,6 +162,9 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	char hexname[PTR_STR_MAXLEN + 1];
 	const char *name;
 	size_t unused;
+#ifdef CONFIG_THREAD_ANALYZER_STACK_WATERMARK
+	size_t used = 0;
+#endif
 	int err;
 	int ret;
 
@@ -176,6 +179,9 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	err = k_thread_runtime_stack_safety_full_check(thread, &unused,
 			(k_thread_stack_safety_handler_t) stack_safety_handler,
 			&info.stack_safety);
+#elif defined(CONFIG_THREAD_ANALYZER_STACK_WATERMARK)
+	err = k_thread_stack_watermark_get(thread, &used);
+	unused = size - used;
 #else
 	err = k_thread_stack_space_get(thread, &unused);
 #endif
@@ -245,14 +245,22 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		}
 	}
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
-				 (ctx->flash_area->fa_off + sector_data.fs_size),
-				 (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
+			       (ctx->flash_area->fa_off + sector_data.fs_size),
+			       (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
 #else
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
 #endif
+
+#ifdef CONFIG_IMG_BLOCK_DOUBLE_BUFFER
+	if (rc == 0) {
+		rc = stream_flash_double_buffer_enable(&ctx->stream, ctx->buf2);
+	}
+#endif
+
+	return rc;
 }
 
 #ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
@@ -104,6 +104,16 @@ int fcb_init(int f_area_id, struct fcb *fcbp)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FCB_INDEX
+	/* The index is attached after init, see fcb_index_attach() */
+	fcbp->f_index = NULL;
+	fcbp->f_index_size = 0U;
+	fcbp->f_index_tag = NULL;
+	fcbp->f_index_head = 0U;
+	fcbp->f_index_cnt = 0U;
+	fcbp->f_index_valid = false;
+#endif
+
 	rc = flash_area_open(f_area_id, &fcbp->fap);
 	if (rc != 0) {
 		return -EINVAL;
@@ -45,6 +45,13 @@ fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc)
 {
 	int rc;
 
+#ifdef CONFIG_FCB_INDEX
+	rc = fcb_index_getnext(fcb, loc);
+	if (rc != -ENOENT) {
+		return rc;
+	}
+#endif
+
 	if (loc->fe_sector == NULL) {
 		/*
 		 * Find the first one we have in flash.
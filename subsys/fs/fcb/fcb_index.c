@@ -0,0 +1,233 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/fs/fcb.h>
+#include "fcb_priv.h"
+
+/*
+ * The index keeps one record per valid entry, ordered from the oldest to the
+ * newest one, in a ring buffer so that rotation only drops records from its
+ * head. Records are ordered by their rank: the distance of their sector from
+ * the oldest sector, then their offset within that sector.
+ */
+
+static inline struct fcb_index_entry *fcb_index_rec(struct fcb *fcbp, uint16_t i)
+{
+	return &fcbp->f_index[(fcbp->f_index_head + i) % fcbp->f_index_size];
+}
+
+static uint64_t fcb_index_rank(const struct fcb *fcbp, uint16_t sector, uint32_t off)
+{
+	uint16_t oldest = fcbp->f_oldest - fcbp->f_sectors;
+	uint16_t dist = (sector + fcbp->f_sector_cnt - oldest) % fcbp->f_sector_cnt;
+
+	return ((uint64_t)dist << 32) | off;
+}
+
+static inline uint64_t fcb_index_rec_rank(struct fcb *fcbp, const struct fcb_index_entry *rec)
+{
+	return fcb_index_rank(fcbp, rec->fie_sector, rec->fie_elem_off);
+}
+
+/* Returns position of the first record with rank not lower than @p rank */
+static uint16_t fcb_index_lower_bound(struct fcb *fcbp, uint64_t rank)
+{
+	uint16_t lo = 0;
+	uint16_t hi = fcbp->f_index_cnt;
+
+	while (lo < hi) {
+		uint16_t mid = lo + (hi - lo) / 2;
+
+		if (fcb_index_rec_rank(fcbp, fcb_index_rec(fcbp, mid)) < rank) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Position of the first record fcb_getnext() would return for @p loc */
+static uint16_t fcb_index_start(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	uint64_t rank;
+
+	if (loc->fe_sector == NULL) {
+		return 0;
+	}
+
+	rank = fcb_index_rank(fcbp, loc->fe_sector - fcbp->f_sectors, loc->fe_elem_off);
+	if (loc->fe_elem_off != 0U) {
+		rank++;
+	}
+
+	return fcb_index_lower_bound(fcbp, rank);
+}
+
+static void fcb_index_fill(struct fcb *fcbp, const struct fcb_index_entry *rec,
+			   struct fcb_entry *loc)
+{
+	loc->fe_sector = &fcbp->f_sectors[rec->fie_sector];
+	loc->fe_elem_off = rec->fie_elem_off;
+	loc->fe_data_len = rec->fie_data_len;
+	/* Length is stored on one byte below 0x80, see fcb_put_len() */
+	loc->fe_data_off = rec->fie_elem_off +
+			   fcb_len_in_flash(fcbp, (rec->fie_data_len < 0x80) ? 1 : 2);
+}
+
+static void fcb_index_set(struct fcb *fcbp, struct fcb_index_entry *rec,
+			  const struct fcb_entry *loc)
+{
+	rec->fie_sector = loc->fe_sector - fcbp->f_sectors;
+	rec->fie_elem_off = loc->fe_elem_off;
+	rec->fie_data_len = loc->fe_data_len;
+	rec->fie_tag = (fcbp->f_index_tag != NULL) ? fcbp->f_index_tag(fcbp, loc) : 0U;
+}
+
+void fcb_index_build(struct fcb *fcbp)
+{
+	struct fcb_entry loc = { 0 };
+
+	if (fcbp->f_index == NULL || fcbp->f_index_size == 0U) {
+		return;
+	}
+
+	/* Make fcb_getnext_nolock() read from flash while building */
+	fcbp->f_index_valid = false;
+	fcbp->f_index_head = 0;
+	fcbp->f_index_cnt = 0;
+
+	while (fcb_getnext_nolock(fcbp, &loc) == 0) {
+		if (fcbp->f_index_cnt == fcbp->f_index_size) {
+			fcbp->f_index_cnt = 0;
+			return;
+		}
+		fcb_index_set(fcbp, fcb_index_rec(fcbp, fcbp->f_index_cnt), &loc);
+		fcbp->f_index_cnt++;
+	}
+
+	fcbp->f_index_valid = true;
+}
+
+void fcb_index_add(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	uint64_t rank;
+	uint16_t i;
+
+	if (!fcbp->f_index_valid) {
+		return;
+	}
+
+	if (fcbp->f_index_cnt == fcbp->f_index_size) {
+		/* Overflow, fall back to flash until the next rotation */
+		fcbp->f_index_valid = false;
+		fcbp->f_index_cnt = 0;
+		return;
+	}
+
+	/* Entries are normally finished in append order, so this is where the
+	 * record goes; otherwise move newer records up to keep the order.
+	 */
+	rank = fcb_index_rank(fcbp, loc->fe_sector - fcbp->f_sectors, loc->fe_elem_off);
+	i = fcbp->f_index_cnt;
+	while (i > 0) {
+		uint64_t prev = fcb_index_rec_rank(fcbp, fcb_index_rec(fcbp, i - 1));
+
+		if (prev == rank) {
+			return;
+		}
+		if (prev < rank) {
+			break;
+		}
+		*fcb_index_rec(fcbp, i) = *fcb_index_rec(fcbp, i - 1);
+		i--;
+	}
+
+	fcb_index_set(fcbp, fcb_index_rec(fcbp, i), loc);
+	fcbp->f_index_cnt++;
+}
+
+void fcb_index_drop_sector(struct fcb *fcbp, const struct flash_sector *sector)
+{
+	uint16_t idx = sector - fcbp->f_sectors;
+
+	while (fcbp->f_index_cnt > 0 && fcb_index_rec(fcbp, 0)->fie_sector == idx) {
+		fcbp->f_index_head = (fcbp->f_index_head + 1) % fcbp->f_index_size;
+		fcbp->f_index_cnt--;
+	}
+}
+
+int fcb_index_getnext(struct fcb *fcbp, struct fcb_entry *loc)
+{
+	uint16_t i;
+
+	if (!fcbp->f_index_valid) {
+		return -ENOENT;
+	}
+
+	i = fcb_index_start(fcbp, loc);
+	if (i >= fcbp->f_index_cnt) {
+		return -ENOTSUP;
+	}
+
+	fcb_index_fill(fcbp, fcb_index_rec(fcbp, i), loc);
+
+	return 0;
+}
+
+int fcb_index_attach(struct fcb *fcbp, struct fcb_index_entry *index, uint16_t size,
+		     fcb_index_tag_cb tag_cb)
+{
+	int rc;
+
+	if (index == NULL || size == 0U) {
+		return -EINVAL;
+	}
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	fcbp->f_index = index;
+	fcbp->f_index_size = size;
+	fcbp->f_index_tag = tag_cb;
+	fcb_index_build(fcbp);
+
+	k_mutex_unlock(&fcbp->f_mtx);
+	return 0;
+}
+
+int fcb_index_find(struct fcb *fcbp, uint32_t tag, struct fcb_entry *loc)
+{
+	int rc;
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	if (!fcbp->f_index_valid) {
+		rc = -ENOENT;
+		goto out;
+	}
+
+	rc = -ENOTSUP;
+	for (uint16_t i = fcb_index_start(fcbp, loc); i < fcbp->f_index_cnt; i++) {
+		const struct fcb_index_entry *rec = fcb_index_rec(fcbp, i);
+
+		if (rec->fie_tag == tag) {
+			fcb_index_fill(fcbp, rec, loc);
+			rc = 0;
+			break;
+		}
+	}
+
+out:
+	k_mutex_unlock(&fcbp->f_mtx);
+	return rc;
+}
@@ -24,6 +24,9 @@ fcb_rotate(struct fcb *fcb)
 		rc = -EIO;
 		goto out;
 	}
+#ifdef CONFIG_FCB_INDEX
+	fcb_index_drop_sector(fcb, fcb->f_oldest);
+#endif
 	if (fcb->f_oldest == fcb->f_active.fe_sector) {
 		/*
 		 * Need to create a new active area, as we're wiping
@@ -39,6 +42,12 @@ fcb_rotate(struct fcb *fcb)
 		fcb->f_active_id++;
 	}
 	fcb->f_oldest = fcb_getnext_sector(fcb, fcb->f_oldest);
+#ifdef CONFIG_FCB_INDEX
+	if (!fcb->f_index_valid) {
+		/* Overflowed earlier, there may be room again */
+		fcb_index_build(fcb);
+	}
+#endif
 out:
 	k_mutex_unlock(&fcb->f_mtx);
 	return rc;
@@ -37,13 +37,26 @@
 BUILD_ASSERT(IS_ENABLED(CONFIG_FS_LITTLEFS_BLK_DEV) ||
 	     IS_ENABLED(CONFIG_FS_LITTLEFS_FMP_DEV));
 
+#define FILE_BUFFER_ENABLED (CONFIG_FS_LITTLEFS_FILE_BUFFER_SIZE > 0)
+
 struct lfs_file_data {
 	struct lfs_file file;
 	struct lfs_file_config config;
 	void *cache_block;
+#if FILE_BUFFER_ENABLED
+	/* Write-behind (or read-ahead for read-only files) buffer */
+	uint8_t *fbuf;
+	size_t fbuf_size;
+	/* Pending write bytes, or valid read-ahead bytes */
+	size_t fbuf_len;
+	/* Read position within the read-ahead data */
+	size_t fbuf_pos;
+	bool fbuf_read;
+#endif
 };
 
 #define LFS_FILEP(fp) (&((struct lfs_file_data *)(fp->filep))->file)
+#define LFS_FDP(fp) ((struct lfs_file_data *)(fp->filep))
 
 /* Global memory pool for open files and dirs */
 K_MEM_SLAB_DEFINE_STATIC(file_data_pool, sizeof(struct lfs_file_data),
@@ -64,9 +77,15 @@ K_MEM_SLAB_DEFINE_STATIC(lfs_dir_pool, sizeof(struct lfs_dir),
 BUILD_ASSERT((CONFIG_FS_LITTLEFS_HEAP_PER_ALLOC_OVERHEAD_SIZE % 8) == 0);
 /* Auto-generate heap size from cache size and number of files */
 #undef CONFIG_FS_LITTLEFS_FC_HEAP_SIZE
+#if FILE_BUFFER_ENABLED
+#define FC_HEAP_FILE_BUFFER_SIZE						\
+	(CONFIG_FS_LITTLEFS_FILE_BUFFER_SIZE + FC_HEAP_PER_ALLOC_OVERHEAD)
+#else
+#define FC_HEAP_FILE_BUFFER_SIZE 0
+#endif
 #define CONFIG_FS_LITTLEFS_FC_HEAP_SIZE						\
-	((CONFIG_FS_LITTLEFS_CACHE_SIZE + FC_HEAP_PER_ALLOC_OVERHEAD) *		\
-	CONFIG_FS_LITTLEFS_NUM_FILES)
+	((CONFIG_FS_LITTLEFS_CACHE_SIZE + FC_HEAP_PER_ALLOC_OVERHEAD +		\
+	  FC_HEAP_FILE_BUFFER_SIZE) * CONFIG_FS_LITTLEFS_NUM_FILES)
 #endif /* CONFIG_FS_LITTLEFS_FC_HEAP_SIZE */
 
 static K_HEAP_DEFINE(file_cache_heap, CONFIG_FS_LITTLEFS_FC_HEAP_SIZE);
@@ -269,6 +288,12 @@ static void release_file_data(struct fs_file_t *fp)
 		fc_release(fdp->cache_block);
 	}
 
+#if FILE_BUFFER_ENABLED
+	if (fdp->fbuf) {
+		fc_release(fdp->fbuf);
+	}
+#endif
+
 	k_mem_slab_free(&file_data_pool, fp->filep);
 	fp->filep = NULL;
 }
@@ -288,6 +313,60 @@ static int lfs_flags_from_zephyr(unsigned int zflags)
 	return flags;
 }
 
+#if FILE_BUFFER_ENABLED
+static void fbuf_allocate(struct lfs_file_data *fdp, size_t min_size)
+{
+	size_t size = CONFIG_FS_LITTLEFS_FILE_BUFFER_SIZE;
+
+	/* Settle for a smaller buffer when the heap is short, but not for
+	 * one that is not larger than the littlefs cache itself.
+	 */
+	while (size > min_size) {
+		fdp->fbuf = fc_allocate(size);
+		if (fdp->fbuf != NULL) {
+			fdp->fbuf_size = size;
+			return;
+		}
+		size /= 2U;
+	}
+}
+
+/* Hand pending writes over to littlefs or, for read-ahead data, move the
+ * littlefs file position back to where the reader is.  Must be called with
+ * the file system locked.
+ */
+static int fbuf_flush(struct fs_littlefs *fs, struct lfs_file_data *fdp)
+{
+	int ret = 0;
+
+	if (fdp->fbuf_read) {
+		if (fdp->fbuf_pos < fdp->fbuf_len) {
+			ret = lfs_file_seek(&fs->lfs, &fdp->file,
+					    -(lfs_soff_t)(fdp->fbuf_len - fdp->fbuf_pos),
+					    LFS_SEEK_CUR);
+		}
+	} else if (fdp->fbuf_len > 0) {
+		ret = lfs_file_write(&fs->lfs, &fdp->file, fdp->fbuf, fdp->fbuf_len);
+	}
+
+	fdp->fbuf_len = 0;
+	fdp->fbuf_pos = 0;
+	fdp->fbuf_read = false;
+
+	return (ret < 0) ? ret : 0;
+}
+
+static inline bool fbuf_readonly(struct lfs_file_data *fdp)
+{
+	return (fdp->file.flags & LFS_O_WRONLY) == 0;
+}
+#else
+static inline int fbuf_flush(struct fs_littlefs *fs, struct lfs_file_data *fdp)
+{
+	return 0;
+}
+#endif /* FILE_BUFFER_ENABLED */
+
 static int littlefs_open(struct fs_file_t *fp, const char *path,
 			 fs_mode_t zflags)
 {
@@ -319,6 +398,12 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 			       path, flags, &fdp->config);
 
 	fs_unlock(fs);
+
+#if FILE_BUFFER_ENABLED
+	if (ret == 0) {
+		fbuf_allocate(fdp, lfs->cfg->cache_size);
+	}
+#endif
 out:
 	if (ret < 0) {
 		release_file_data(fp);
@@ -333,13 +418,14 @@ static int littlefs_close(struct fs_file_t *fp)
 
 	fs_lock(fs);
 
+	int flush_ret = fbuf_flush(fs, LFS_FDP(fp));
 	int ret = lfs_file_close(&fs->lfs, LFS_FILEP(fp));
 
 	fs_unlock(fs);
 
 	release_file_data(fp);
 
-	return lfs_to_errno(ret);
+	return lfs_to_errno((flush_ret < 0) ? flush_ret : ret);
 }
 
 static int littlefs_unlink(struct fs_mount_t *mountp, const char *path)
@@ -372,13 +458,72 @@ static int littlefs_rename(struct fs_mount_t *mountp, const char *from,
 	return lfs_to_errno(ret);
 }
 
+#if FILE_BUFFER_ENABLED
+static ssize_t littlefs_read_ahead(struct fs_file_t *fp, uint8_t *ptr, size_t len)
+{
+	struct fs_littlefs *fs = fp->mp->fs_data;
+	struct lfs_file_data *fdp = LFS_FDP(fp);
+	size_t done = 0;
+	ssize_t ret = 0;
+
+	while (done < len) {
+		size_t avail = fdp->fbuf_len - fdp->fbuf_pos;
+
+		if (avail > 0) {
+			size_t n = MIN(avail, len - done);
+
+			memcpy(ptr + done, fdp->fbuf + fdp->fbuf_pos, n);
+			fdp->fbuf_pos += n;
+			done += n;
+			continue;
+		}
+
+		fs_lock(fs);
+
+		if (len - done >= fdp->fbuf_size) {
+			/* Large reads bypass the buffer */
+			ret = lfs_file_read(&fs->lfs, &fdp->file, ptr + done, len - done);
+			fs_unlock(fs);
+			if (ret > 0) {
+				done += ret;
+			}
+			break;
+		}
+
+		ret = lfs_file_read(&fs->lfs, &fdp->file, fdp->fbuf, fdp->fbuf_size);
+
+		fs_unlock(fs);
+
+		if (ret <= 0) {
+			break;
+		}
+
+		fdp->fbuf_len = ret;
+		fdp->fbuf_pos = 0;
+		fdp->fbuf_read = true;
+	}
+
+	return (done > 0) ? (ssize_t)done : lfs_to_errno(ret);
+}
+#endif /* FILE_BUFFER_ENABLED */
+
 static ssize_t littlefs_read(struct fs_file_t *fp, void *ptr, size_t len)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
+#if FILE_BUFFER_ENABLED
+	if ((LFS_FDP(fp)->fbuf != NULL) && fbuf_readonly(LFS_FDP(fp))) {
+		return littlefs_read_ahead(fp, ptr, len);
+	}
+#endif
+
 	fs_lock(fs);
 
-	ssize_t ret = lfs_file_read(&fs->lfs, LFS_FILEP(fp), ptr, len);
+	ssize_t ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_read(&fs->lfs, LFS_FILEP(fp), ptr, len);
+	}
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -388,9 +533,36 @@ static ssize_t littlefs_write(struct fs_file_t *fp, const void *ptr, size_t len)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
+#if FILE_BUFFER_ENABLED
+	struct lfs_file_data *fdp = LFS_FDP(fp);
+
+	if ((fdp->fbuf != NULL) && !fdp->fbuf_read && (len < fdp->fbuf_size) &&
+	    !fbuf_readonly(fdp)) {
+		if (fdp->fbuf_len + len > fdp->fbuf_size) {
+			fs_lock(fs);
+
+			int ret = fbuf_flush(fs, fdp);
+
+			fs_unlock(fs);
+			if (ret < 0) {
+				return lfs_to_errno(ret);
+			}
+		}
+
+		memcpy(fdp->fbuf + fdp->fbuf_len, ptr, len);
+		fdp->fbuf_len += len;
+
+		return len;
+	}
+#endif
+
 	fs_lock(fs);
 
-	ssize_t ret = lfs_file_write(&fs->lfs, LFS_FILEP(fp), ptr, len);
+	ssize_t ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_write(&fs->lfs, LFS_FILEP(fp), ptr, len);
+	}
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -406,7 +578,11 @@ static int littlefs_seek(struct fs_file_t *fp, off_t off, int whence)
 
 	fs_lock(fs);
 
-	off_t ret = lfs_file_seek(&fs->lfs, LFS_FILEP(fp), off, whence);
+	off_t ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_seek(&fs->lfs, LFS_FILEP(fp), off, whence);
+	}
 
 	fs_unlock(fs);
 
@@ -423,7 +599,13 @@ static off_t littlefs_tell(struct fs_file_t *fp)
 
 	fs_lock(fs);
 
-	off_t ret = lfs_file_tell(&fs->lfs, LFS_FILEP(fp));
+	off_t ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_tell(&fs->lfs, LFS_FILEP(fp));
+	} else {
+		ret = lfs_to_errno(ret);
+	}
 
 	fs_unlock(fs);
 	return ret;
@@ -435,7 +617,11 @@ static int littlefs_truncate(struct fs_file_t *fp, off_t length)
 
 	fs_lock(fs);
 
-	int ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
+	int ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
+	}
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -447,7 +633,11 @@ static int littlefs_sync(struct fs_file_t *fp)
 
 	fs_lock(fs);
 
-	int ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
+	int ret = fbuf_flush(fs, LFS_FDP(fp));
+
+	if (ret == 0) {
+		ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
+	}
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
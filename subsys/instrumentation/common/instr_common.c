@@ -52,28 +52,59 @@ static bool _instr_dynamic_trigger_supported = IS_ENABLED(CONFIG_INSTRUMENTATION
 
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
 /*
- * Entry for discovered functions. The functions are added to 'disco_func' array
- * as they are called in the execution flow, hence "discovered" functions. Once
- * MAX_NUM_DISCO_FUNC is reached, additional new executed functions are ignored and
- * no profiling information is collected for them.
+ * Entry for discovered functions. The functions are added to the 'disco_func' hash
+ * table, indexed by their address, as they are called in the execution flow, hence
+ * "discovered" functions. Once MAX_NUM_DISCO_FUNC is reached, additional new executed
+ * functions are ignored and no profiling information is collected for them.
  */
 
 #define MAX_CALL_DEPTH CONFIG_INSTRUMENTATION_MODE_STATISTICAL_MAX_CALL_DEPTH
 struct disco_func_entry {
-	timing_t entry_timestamp;		/* Timestamp at function entry */
-	uint64_t delta_t;			/* Accumulated (per function) delta time */
 	void *addr;				/* Function address/ID */
+	uint64_t incl_cycles;			/* Accumulated time, callees included */
+	uint64_t excl_cycles;			/* Accumulated time, callees excluded */
+	uint32_t calls;				/* Number of calls */
 	uint16_t call_depth;			/* Call depth */
 };
 
 #define MAX_NUM_DISCO_FUNC CONFIG_INSTRUMENTATION_MODE_STATISTICAL_MAX_NUM_FUNC
+/* Open addressing hash table, kept at most half full so lookups stay short */
+#define DISCO_FUNC_TABLE_SIZE NHPOT(2 * MAX_NUM_DISCO_FUNC)
 static int num_disco_func;
-struct disco_func_entry disco_func[MAX_NUM_DISCO_FUNC] = { 0 };
+static struct disco_func_entry disco_func[DISCO_FUNC_TABLE_SIZE];
+
+/*
+ * Shadow call stack, used to subtract the time spent in callees from the exclusive
+ * time of a function. Calls deeper than MAX_STACK_DEPTH are only counted.
+ */
+#define MAX_STACK_DEPTH CONFIG_INSTRUMENTATION_MODE_STATISTICAL_STACK_DEPTH
+struct call_frame {
+	struct disco_func_entry *func;
+	uint64_t entry_cycles;
+	uint64_t callee_cycles;
+};
+
+static struct call_frame call_stack[MAX_STACK_DEPTH];
+static int call_stack_depth;
+static int call_stack_overflow;
 
 /* To track the number of unbalanced/spurious entry/exist pairs, for debugging */
 static int unbalanced;
 #endif
 
+#if CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES > 0
+/* Address ranges set at runtime to only instrument hot paths */
+struct instr_filter {
+	uintptr_t start;
+	uintptr_t end;
+	bool include;
+};
+
+static struct instr_filter filters[CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES];
+static int num_filters;
+static int num_include_filters;
+#endif
+
 #ifdef CONFIG_THREAD_NAME
 #define THREAD_NAME_NONE "thread-none"
 #endif
@@ -325,6 +356,62 @@ void instr_dump_buffer_uart(void)
 #endif
 }
 
+#if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
+__no_instrumentation__
+static void uart_out(const struct device *uart_dev, const void *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		uart_poll_out(uart_dev, ((const uint8_t *)data)[i]);
+	}
+}
+
+__no_instrumentation__
+static inline uint64_t disco_func_key(const struct disco_func_entry *func, bool inclusive)
+{
+	return inclusive ? func->incl_cycles : func->excl_cycles;
+}
+
+/* Report order: decreasing time, then increasing address */
+__no_instrumentation__
+static bool disco_func_before(const struct disco_func_entry *a,
+			      const struct disco_func_entry *b, bool inclusive)
+{
+	uint64_t key_a = disco_func_key(a, inclusive);
+	uint64_t key_b = disco_func_key(b, inclusive);
+
+	return key_a > key_b || (key_a == key_b && a->addr < b->addr);
+}
+
+/*
+ * Selects the entry following 'prev' in the report order. This is quadratic but
+ * only runs when dumping, and does not need any memory besides the table.
+ */
+__no_instrumentation__
+static const struct disco_func_entry *disco_func_next(const struct disco_func_entry *prev,
+						      bool inclusive)
+{
+	const struct disco_func_entry *next = NULL;
+
+	for (size_t i = 0; i < DISCO_FUNC_TABLE_SIZE; i++) {
+		const struct disco_func_entry *func = &disco_func[i];
+
+		if (func->addr == NULL) {
+			continue;
+		}
+
+		if (prev != NULL && !disco_func_before(prev, func, inclusive)) {
+			continue;
+		}
+
+		if (next == NULL || disco_func_before(func, next, inclusive)) {
+			next = func;
+		}
+	}
+
+	return next;
+}
+#endif
+
 __no_instrumentation__
 void instr_dump_deltas_uart(void)
 {
@@ -337,91 +424,281 @@ void instr_dump_deltas_uart(void)
 	/* Initiator mark */
 	printk("-*-#");
 
-	for (int i = 0; i < num_disco_func; i++) {
-		uart_poll_out(uart_dev, INSTR_EVENT_PROFILE);
-		for (int j = 0; j < sizeof(disco_func[i].addr); j++) {
-			uart_poll_out(uart_dev, *((uint8_t *)&disco_func[i].addr + j));
+	for (size_t i = 0; i < DISCO_FUNC_TABLE_SIZE; i++) {
+		uint64_t delta_t;
+
+		if (disco_func[i].addr == NULL) {
+			continue;
 		}
-		for (int k = 0; k < sizeof(disco_func[i].delta_t); k++) {
-			uart_poll_out(uart_dev, *((uint8_t *)&disco_func[i].delta_t + k));
+
+		delta_t = instr_timestamp_cycles_to_ns(disco_func[i].incl_cycles);
+
+		uart_poll_out(uart_dev, INSTR_EVENT_PROFILE);
+		uart_out(uart_dev, &disco_func[i].addr, sizeof(disco_func[i].addr));
+		uart_out(uart_dev, &delta_t, sizeof(delta_t));
+	}
+
+	/* Terminator mark */
+	printk("-*-!\n");
+#endif
+}
+
+__no_instrumentation__
+void instr_dump_stats_uart(uint32_t top_n, bool inclusive)
+{
+#if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
+	static const struct device *const uart_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_console));
+	const struct disco_func_entry *func = NULL;
+
+	instr_disable();
+
+	/* Initiator mark */
+	printk("-*-#");
+
+	for (uint32_t n = 0; top_n == 0 || n < top_n; n++) {
+		uint64_t incl_t;
+		uint64_t excl_t;
+
+		func = disco_func_next(func, inclusive);
+		if (func == NULL) {
+			break;
 		}
+
+		incl_t = instr_timestamp_cycles_to_ns(func->incl_cycles);
+		excl_t = instr_timestamp_cycles_to_ns(func->excl_cycles);
+
+		uart_poll_out(uart_dev, INSTR_EVENT_PROFILE_STATS);
+		uart_out(uart_dev, &func->addr, sizeof(func->addr));
+		uart_out(uart_dev, &func->calls, sizeof(func->calls));
+		uart_out(uart_dev, &incl_t, sizeof(incl_t));
+		uart_out(uart_dev, &excl_t, sizeof(excl_t));
 	}
 
 	/* Terminator mark */
 	printk("-*-!\n");
+#else
+	ARG_UNUSED(top_n);
+	ARG_UNUSED(inclusive);
 #endif
 }
 
+__no_instrumentation__
+void instr_profile_reset(void)
+{
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
+	unsigned int key = irq_lock();
+
+	memset(disco_func, 0, sizeof(disco_func));
+	num_disco_func = 0;
+	call_stack_depth = 0;
+	call_stack_overflow = 0;
+	unbalanced = 0;
+
+	irq_unlock(key);
+
+	/* Resume collection, dumping disables it */
+	instr_enable();
+#endif
+}
+
 __no_instrumentation__
-void push_callee_timestamp(void *callee)
+int instr_filter_add(void *start, void *end, bool include)
 {
-	bool found = false;
-	int curr_func;
+#if CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES > 0
+	unsigned int key;
+	int ret = 0;
 
-	/* Find callee in the discovered function array */
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			found = true;
-			break;
+	if ((uintptr_t)end <= (uintptr_t)start) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (num_filters == ARRAY_SIZE(filters)) {
+		ret = -ENOMEM;
+	} else {
+		filters[num_filters].start = (uintptr_t)start;
+		filters[num_filters].end = (uintptr_t)end;
+		filters[num_filters].include = include;
+		num_filters++;
+		if (include) {
+			num_include_filters++;
 		}
 	}
 
-	if (!found) { /* New function discovered */
-		if (num_disco_func >= MAX_NUM_DISCO_FUNC) {
-			/* No more space to add another function */
-			return;
+	irq_unlock(key);
+
+	return ret;
+#else
+	ARG_UNUSED(start);
+	ARG_UNUSED(end);
+	ARG_UNUSED(include);
+
+	return -ENOTSUP;
+#endif
+}
+
+__no_instrumentation__
+void instr_filter_clear(void)
+{
+#if CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES > 0
+	unsigned int key = irq_lock();
+
+	num_filters = 0;
+	num_include_filters = 0;
+
+	irq_unlock(key);
+#endif
+}
+
+__no_instrumentation__
+bool instr_filter_pass(void *callee)
+{
+#if CONFIG_INSTRUMENTATION_FILTER_MAX_RANGES > 0
+	bool included = false;
+
+	for (int i = 0; i < num_filters; i++) {
+		if ((uintptr_t)callee < filters[i].start || (uintptr_t)callee >= filters[i].end) {
+			continue;
 		}
 
-		disco_func[curr_func].delta_t = 0;
-		disco_func[curr_func].call_depth = 0;
-		disco_func[curr_func].addr = callee;
+		if (!filters[i].include) {
+			return false;
+		}
 
-		num_disco_func++;
+		included = true;
 	}
 
-	/* New function or no other instance of function active (called): record timestamp */
-	if (disco_func[curr_func].call_depth == 0) {
-		disco_func[curr_func].entry_timestamp = instr_timestamp_ns();
+	return included || num_include_filters == 0;
+#else
+	ARG_UNUSED(callee);
+
+	return true;
+#endif
+}
+
+#if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
+__no_instrumentation__
+static inline uint32_t disco_func_hash(void *addr)
+{
+	/* Fibonacci hashing, function addresses are at least 2 bytes aligned */
+	return (uint32_t)(((uintptr_t)addr >> 1) * 2654435769U) >>
+	       (32 - LOG2(DISCO_FUNC_TABLE_SIZE));
+}
+
+__no_instrumentation__
+static struct disco_func_entry *disco_func_find(void *callee, bool add)
+{
+	uint32_t i = disco_func_hash(callee);
+
+	/* Never full, there is always an empty slot to stop at */
+	while (disco_func[i].addr != NULL) {
+		if (disco_func[i].addr == callee) {
+			return &disco_func[i];
+		}
+
+		i = (i + 1) & (DISCO_FUNC_TABLE_SIZE - 1);
 	}
 
-	/* Update call depth if not reached out maximum call depth */
-	if (disco_func[curr_func].call_depth < MAX_CALL_DEPTH) {
-		disco_func[curr_func].call_depth++;
+	if (!add || num_disco_func >= MAX_NUM_DISCO_FUNC) {
+		/* No more space to add another function */
+		return NULL;
 	}
+
+	/* New function discovered */
+	disco_func[i].addr = callee;
+	num_disco_func++;
+
+	return &disco_func[i];
 }
 
 __no_instrumentation__
-void pop_callee_timestamp(void *callee)
+static void call_frame_pop(uint64_t now)
 {
-	uint64_t dt_ns;
-	uint64_t entry_timestamp;
-	uint64_t exit_timestamp;
-	int curr_func;
+	struct call_frame *frame = &call_stack[--call_stack_depth];
+	struct disco_func_entry *func = frame->func;
+	uint64_t dt = now - frame->entry_cycles;
 
-	for (curr_func = 0; curr_func < num_disco_func; curr_func++) {
-		if (disco_func[curr_func].addr == callee) {
-			disco_func[curr_func].call_depth--;
+	func->excl_cycles += dt - frame->callee_cycles;
 
-			/* Last active function is returning */
-			if (disco_func[curr_func].call_depth == 0) {
-				entry_timestamp = disco_func[curr_func].entry_timestamp;
-				exit_timestamp = instr_timestamp_ns(); /* Now */
+	if (func->call_depth > 0) {
+		func->call_depth--;
+	}
 
-				/* Compute delta T */
-				dt_ns = exit_timestamp - entry_timestamp;
+	/* Only the outermost instance of a recursive function accounts inclusive time */
+	if (func->call_depth == 0) {
+		func->incl_cycles += dt;
+	}
 
-				/* Accumulate delta T */
-				disco_func[curr_func].delta_t += dt_ns;
+	if (call_stack_depth > 0) {
+		call_stack[call_stack_depth - 1].callee_cycles += dt;
+	}
+}
 
-			}
+__no_instrumentation__
+void push_callee_timestamp(void *callee)
+{
+	struct disco_func_entry *func = disco_func_find(callee, true);
+	struct call_frame *frame;
 
-			return;
+	if (func == NULL) {
+		return;
+	}
+
+	func->calls++;
+
+	if (call_stack_depth == MAX_STACK_DEPTH) {
+		call_stack_overflow++;
+		return;
+	}
+
+	/* Update call depth if not reached out maximum call depth */
+	if (func->call_depth < MAX_CALL_DEPTH) {
+		func->call_depth++;
+	}
+
+	frame = &call_stack[call_stack_depth++];
+	frame->func = func;
+	frame->callee_cycles = 0;
+	frame->entry_cycles = instr_timestamp_cycles();
+}
+
+__no_instrumentation__
+void pop_callee_timestamp(void *callee)
+{
+	uint64_t now = instr_timestamp_cycles();
+	struct disco_func_entry *func = disco_func_find(callee, false);
+	int depth;
+
+	if (func == NULL) {
+		return;
+	}
+
+	if (call_stack_overflow > 0) {
+		call_stack_overflow--;
+		return;
+	}
+
+	for (depth = call_stack_depth; depth > 0; depth--) {
+		if (call_stack[depth - 1].func == func) {
+			break;
 		}
 	}
 
-	/* Track number of unbalanced/spurious function exits */
-	unbalanced++;
+	if (depth == 0) {
+		/* Track number of unbalanced/spurious function exits */
+		unbalanced++;
+		return;
+	}
+
+	/*
+	 * Frames above the callee have no exit, e.g. their thread was switched out,
+	 * account them up to now.
+	 */
+	while (call_stack_depth >= depth) {
+		call_frame_pop(now);
+	}
 }
 #endif
 
@@ -559,7 +836,7 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 
 #if defined(CONFIG_INSTRUMENTATION_MODE_STATISTICAL)
 	/* Profiling */
-	if (!_instr_profiling_disabled) {
+	if (!_instr_profiling_disabled && instr_filter_pass(callee)) {
 		if (type == INSTR_EVENT_ENTRY) {
 			/* Record current timestamp */
 			push_callee_timestamp(callee);
@@ -575,7 +852,9 @@ void instr_event_handler(enum instr_event_types type, void *callee, void *caller
 #if defined(CONFIG_INSTRUMENTATION_MODE_CALLGRAPH)
 	/* For tracing, promote type based on the context */
 	type = promote_event_type(type, callee, &key);
-	if (type == INSTR_EVENT_INVALID) {
+	if (type == INSTR_EVENT_INVALID ||
+	    ((type == INSTR_EVENT_ENTRY || type == INSTR_EVENT_EXIT) &&
+	     !instr_filter_pass(callee))) {
 		/* Don't trace invalid events */
 		instr_enable();
 		return;
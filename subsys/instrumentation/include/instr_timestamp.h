@@ -23,4 +23,16 @@ int instr_timestamp_init(void);
  */
 uint64_t instr_timestamp_ns(void);
 
+/**
+ * @brief Get current timestamp in cycles
+ *
+ */
+uint64_t instr_timestamp_cycles(void);
+
+/**
+ * @brief Convert a duration in cycles to nanoseconds
+ *
+ */
+uint64_t instr_timestamp_cycles_to_ns(uint64_t cycles);
+
 #endif /* ZEPHYR_INCLUDE_INSTRUMENTATION_TIMESTAMP_H_ */
@@ -17,14 +17,24 @@ int instr_timestamp_init(void)
 }
 
 __no_instrumentation__
-uint64_t instr_timestamp_ns(void)
+uint64_t instr_timestamp_cycles(void)
 {
 	timing_t bigbang = 0;
 	timing_t now;
-	uint64_t now_cycles;
 
 	now = timing_counter_get();
-	now_cycles = timing_cycles_get(&bigbang, &now);
 
-	return timing_cycles_to_ns(now_cycles);
+	return timing_cycles_get(&bigbang, &now);
+}
+
+__no_instrumentation__
+uint64_t instr_timestamp_cycles_to_ns(uint64_t cycles)
+{
+	return timing_cycles_to_ns(cycles);
+}
+
+__no_instrumentation__
+uint64_t instr_timestamp_ns(void)
+{
+	return instr_timestamp_cycles_to_ns(instr_timestamp_cycles());
 }
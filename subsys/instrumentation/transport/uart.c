@@ -14,7 +14,7 @@
 #include <zephyr/drivers/uart.h>
 #include <zephyr/instrumentation/instrumentation.h>
 
-#define COMMAND_BUFFER_SIZE 32
+#define COMMAND_BUFFER_SIZE 64
 char _cmd_buffer[COMMAND_BUFFER_SIZE];
 
 __no_instrumentation__
@@ -35,6 +35,26 @@ void handle_cmd(char *cmd, uint32_t length)
 		instr_dump_buffer_uart();
 	} else if (strncmp("dump_profile", cmd, length) == 0) {
 		instr_dump_deltas_uart();
+	} else if (strncmp(cmd, "dump_stats", strlen("dump_stats")) == 0) {
+		beginptr = cmd + strlen("dump_stats");
+		address = strtol(beginptr, &endptr, 10);
+		instr_dump_stats_uart((uint32_t)address, strstr(endptr, "incl") != NULL);
+	} else if (strncmp("profile_reset", cmd, length) == 0) {
+		instr_profile_reset();
+	} else if (strncmp("filter_clear", cmd, length) == 0) {
+		instr_filter_clear();
+	} else if (strncmp(cmd, "include", strlen("include")) == 0 ||
+		   strncmp(cmd, "exclude", strlen("exclude")) == 0) {
+		unsigned long start;
+		unsigned long end;
+
+		beginptr = cmd + strlen("include");
+		start = strtoul(beginptr, &endptr, 16);
+		end = strtoul(endptr, &beginptr, 16);
+		if (beginptr == endptr ||
+		    instr_filter_add((void *)start, (void *)end, cmd[0] == 'i') != 0) {
+			printk("%.7s: invalid argument in: '%s'\n", cmd, cmd);
+		}
 	} else if (strncmp(cmd, "trigger", strlen("trigger")) == 0) {
 		beginptr = cmd + strlen("trigger");
 		address = strtol(beginptr, &endptr, 16);
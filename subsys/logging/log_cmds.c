@@ -429,6 +429,113 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+/* Apply @p set to modules listed in @p argv, all modules if @p argc is 0. */
+static int limit_set(const struct shell *sh, size_t argc, char **argv,
+		     int (*set)(int16_t id, uint16_t arg0, uint16_t arg1),
+		     uint16_t arg0, uint16_t arg1)
+{
+	bool all = argc ? false : true;
+	int cnt = all ? log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID) : argc;
+
+	for (int i = 0; i < cnt; i++) {
+		int id = all ? i : module_id_get(argv[i]);
+
+		if (id < 0) {
+			shell_error(sh, "%s: unknown source name.", argv[i]);
+			return -ENOEXEC;
+		}
+
+		if (set(id, arg0, arg1) < 0) {
+			shell_error(sh, "%s: invalid value.",
+				    log_source_name_get(Z_LOG_LOCAL_DOMAIN_ID, id));
+			return -ENOEXEC;
+		}
+	}
+
+	return 0;
+}
+
+static int ratelimit_set(int16_t id, uint16_t rate, uint16_t burst)
+{
+	return log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, id, rate, burst);
+}
+
+static int cmd_log_ratelimit(const struct shell *sh, size_t argc, char **argv)
+{
+	uint16_t rate;
+	uint16_t burst;
+	int err = 0;
+
+	if (argc == 1) {
+		uint32_t modules_cnt = log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID);
+
+		shell_fprintf(sh, SHELL_NORMAL, "%-40s | rate  | burst \r\n", "module_name");
+		shell_fprintf(sh, SHELL_NORMAL,
+		      "----------------------------------------------------------\r\n");
+
+		for (int16_t i = 0U; i < modules_cnt; i++) {
+			(void)log_source_ratelimit_get(Z_LOG_LOCAL_DOMAIN_ID, i, &rate, &burst);
+			shell_fprintf(sh, SHELL_NORMAL, "%-40s | %-5u | %u\r\n",
+				      log_source_name_get(Z_LOG_LOCAL_DOMAIN_ID, i), rate, burst);
+		}
+
+		return 0;
+	}
+
+	if (argc < 3) {
+		shell_error(sh, "Missing burst.");
+		return -EINVAL;
+	}
+
+	rate = (uint16_t)shell_strtoul(argv[1], 10, &err);
+	burst = (uint16_t)shell_strtoul(argv[2], 10, &err);
+	if (err != 0) {
+		shell_error(sh, "Invalid rate or burst.");
+		return -EINVAL;
+	}
+
+	/* Arguments following burst are interpreted as module names. */
+	return limit_set(sh, argc - 3, &argv[3], ratelimit_set, rate, burst);
+}
+
+static int dedup_set(int16_t id, uint16_t enable, uint16_t unused)
+{
+	ARG_UNUSED(unused);
+
+	return log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, id, enable != 0U);
+}
+
+static int cmd_log_dedup(const struct shell *sh, size_t argc, char **argv)
+{
+	bool enable;
+	int err = 0;
+
+	if (argc == 1) {
+		uint32_t modules_cnt = log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID);
+
+		shell_fprintf(sh, SHELL_NORMAL, "%-40s | dedup \r\n", "module_name");
+		shell_fprintf(sh, SHELL_NORMAL,
+		      "----------------------------------------------------------\r\n");
+
+		for (int16_t i = 0U; i < modules_cnt; i++) {
+			shell_fprintf(sh, SHELL_NORMAL, "%-40s | %s\r\n",
+				      log_source_name_get(Z_LOG_LOCAL_DOMAIN_ID, i),
+				      log_source_dedup_get(Z_LOG_LOCAL_DOMAIN_ID, i) ? "on" : "off");
+		}
+
+		return 0;
+	}
+
+	enable = shell_strtobool(argv[1], 0, &err);
+	if (err != 0) {
+		shell_error(sh, "Invalid value: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	/* Arguments following on/off are interpreted as module names. */
+	return limit_set(sh, argc - 2, &argv[2], dedup_set, enable, 0);
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_backend,
 	SHELL_CMD_ARG(disable, &dsub_module_name,
 		  "'log disable <module_0> .. <module_n>' disables logs in "
@@ -488,6 +595,16 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		       cmd_log_self_status),
 	SHELL_COND_CMD(CONFIG_LOG_MODE_DEFERRED, mem, NULL, "Logger memory usage",
 		       cmd_log_mem),
+	SHELL_COND_CMD_ARG(CONFIG_LOG_SOURCE_RATELIMIT, ratelimit, NULL,
+			   "'log ratelimit <rate> <burst> <module_0> .. <module_n>' limits "
+			   "specified modules (all if no modules specified) to <rate> messages "
+			   "per second, 0 disables the limit. Without arguments prints limits.",
+			   cmd_log_ratelimit, 1, 255),
+	SHELL_COND_CMD_ARG(CONFIG_LOG_SOURCE_DEDUP, dedup, NULL,
+			   "'log dedup <on|off> <module_0> .. <module_n>' collapses repeated "
+			   "messages in specified modules (all if no modules specified). Without "
+			   "arguments prints current setting.",
+			   cmd_log_dedup, 1, 255),
 	SHELL_COND_CMD(CONFIG_LOG_FRONTEND, FRONTEND_NAME, &sub_log_backend,
 		"Frontend control", NULL),
 	SHELL_SUBCMD_SET_END);
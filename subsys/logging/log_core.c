@@ -292,6 +292,10 @@ void log_core_init(void)
 		z_log_runtime_filters_init();
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT) || IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) {
+		z_log_source_limit_init();
+	}
+
 	STRUCT_SECTION_FOREACH(log_backend, backend) {
 		uint32_t id;
 		/* As first slot in filtering mask is reserved, backend ID has offset.*/
@@ -507,7 +511,7 @@ static bool msg_filter_check(struct log_backend const *backend,
 	}
 }
 
-static void msg_process(union log_msg_generic *msg)
+void z_log_msg_dispatch(union log_msg_generic *msg)
 {
 	STRUCT_SECTION_FOREACH(log_backend, backend) {
 		if (log_backend_is_active(backend) &&
@@ -517,6 +521,15 @@ static void msg_process(union log_msg_generic *msg)
 	}
 }
 
+static void msg_process(union log_msg_generic *msg)
+{
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP) && !z_log_source_dedup_check(msg)) {
+		return;
+	}
+
+	z_log_msg_dispatch(msg);
+}
+
 void dropped_notify(void)
 {
 	uint32_t dropped = z_log_dropped_read_and_clear();
@@ -579,6 +592,11 @@ bool z_impl_log_process(void)
 		k_timer_start(&log_process_thread_timer, backoff, K_NO_WAIT);
 
 		return false;
+	} else if (IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT) || IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) {
+		/* Buffer is empty, report messages suppressed by sources which
+		 * stopped logging.
+		 */
+		(void)z_log_source_limit_flush();
 	}
 
 	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -968,11 +986,20 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 
 
 		if (log_process() == false) {
+			k_timeout_t wait = timeout;
+
 			if (processed_any) {
 				processed_any = false;
 				log_backend_notify_all(LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
 			}
-			(void)k_sem_take(&log_process_thread_sem, timeout);
+
+			/* Wake up to report suppressed messages if sources went quiet. */
+			if ((IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT) ||
+			     IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) &&
+			    z_log_source_limit_flush()) {
+				wait = K_MSEC(Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS);
+			}
+			(void)k_sem_take(&log_process_thread_sem, wait);
 		} else {
 			processed_any = true;
 		}
@@ -11,6 +11,37 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
+
+/* Messages are gathered in the output buffer so that, when it is large
+ * enough, each message reaches the output function in a single call. This
+ * lets packet based backends (network, MQTT) send one message per packet.
+ * In immediate mode the buffer may be used from several contexts at once,
+ * so data is written out directly.
+ */
+static void dict_output_write(const struct log_output *output, uint8_t *data, size_t len)
+{
+	struct log_output_control_block *cb = output->control_block;
+
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		log_output_write(output->func, data, len, (void *)cb->ctx);
+		return;
+	}
+
+	while (len > 0U) {
+		size_t chunk;
+
+		if ((size_t)cb->offset == output->size) {
+			log_output_flush(output);
+		}
+
+		chunk = MIN(len, output->size - (size_t)cb->offset);
+		memcpy(&output->buf[cb->offset], data, chunk);
+		cb->offset += chunk;
+		data += chunk;
+		len -= chunk;
+	}
+}
 
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
@@ -28,19 +59,18 @@ void log_dict_output_msg_process(const struct log_output *output,
 
 	output_hdr.source = (source != NULL) ? log_source_id(source) : 0U;
 
-	log_output_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
-			 (void *)output->control_block->ctx);
+	dict_output_write(output, (uint8_t *)&output_hdr, sizeof(output_hdr));
 
 	size_t len;
 	uint8_t *data = log_msg_get_package(msg, &len);
 
 	if (len > 0U) {
-		log_output_write(output->func, data, len, (void *)output->control_block->ctx);
+		dict_output_write(output, data, len);
 	}
 
 	data = log_msg_get_data(msg, &len);
 	if (len > 0U) {
-		log_output_write(output->func, data, len, (void *)output->control_block->ctx);
+		dict_output_write(output, data, len);
 	}
 
 	log_output_flush(output);
@@ -53,6 +83,6 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 	msg.type = MSG_DROPPED_MSG;
 	msg.num_dropped_messages = MIN(cnt, 9999);
 
-	log_output_write(output->func, (uint8_t *)&msg, sizeof(msg),
-			 (void *)output->control_block->ctx);
+	dict_output_write(output, (uint8_t *)&msg, sizeof(msg));
+	log_output_flush(output);
 }
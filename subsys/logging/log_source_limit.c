@@ -0,0 +1,397 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/sys/atomic.h>
+
+/* Per source state is kept in the dynamic data of the source, see
+ * struct log_source_limit. The rate limit is checked in the logging macros
+ * right after the level filtering, before the message is packaged and
+ * allocated. Repeated messages are detected when messages are processed,
+ * by comparing their content.
+ */
+
+BUILD_ASSERT(!IS_ENABLED(CONFIG_64BIT) || (sizeof(struct log_source_dynamic_data) % 8) == 0,
+	     "Dynamic data size must be a multiple of 8 bytes");
+
+struct limit_report {
+	uint32_t repeat_cnt;
+	uint32_t dropped;
+	uint8_t repeat_level;
+};
+
+static struct k_spinlock lock;
+static atomic_t pending;
+static uint32_t last_flush;
+
+static inline struct log_source_limit *limit_get(int16_t source_id)
+{
+	return &TYPE_SECTION_START(log_dynamic)[source_id].limit;
+}
+
+static int source_check(uint32_t domain_id, int16_t source_id)
+{
+	if (domain_id != Z_LOG_LOCAL_DOMAIN_ID) {
+		return -ENOTSUP;
+	}
+
+	if (source_id < 0 || source_id >= z_log_sources_count()) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+#define REPEAT_PACKAGE_SIZE (sizeof(union cbprintf_package_hdr) + 3 * sizeof(void *))
+
+/* Report repetitions directly to the backends, so that the report precedes
+ * the message which ends the repetitions also in deferred mode.
+ */
+static void repeat_report(const void *source, uint8_t level, uint32_t cnt,
+			  log_timestamp_t timestamp)
+{
+	uint8_t buf[sizeof(struct log_msg) + REPEAT_PACKAGE_SIZE] __aligned(Z_LOG_MSG_ALIGNMENT);
+	struct log_msg *msg = (struct log_msg *)buf;
+	int plen;
+
+	plen = cbprintf_package(msg->data, REPEAT_PACKAGE_SIZE, 0,
+				"Last message repeated %u times", cnt);
+	__ASSERT_NO_MSG(plen > 0);
+	if (plen <= 0) {
+		return;
+	}
+
+	struct log_msg_desc desc =
+		Z_LOG_MSG_DESC_INITIALIZER(Z_LOG_LOCAL_DOMAIN_ID, level, plen, 0);
+
+	msg->hdr.desc = desc;
+	msg->hdr.source = source;
+	msg->hdr.timestamp = timestamp;
+#if CONFIG_LOG_THREAD_ID_PREFIX
+	msg->hdr.tid = NULL;
+#endif
+
+	z_log_msg_dispatch((union log_msg_generic *)msg);
+}
+
+/* FNV-1a hash of the message package and data, 0 is reserved for no message. */
+static uint32_t msg_hash(struct log_msg *msg)
+{
+	uint32_t hash = 2166136261U;
+	size_t len;
+	uint8_t *p;
+
+	p = log_msg_get_package(msg, &len);
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	p = log_msg_get_data(msg, &len);
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return (hash != 0U) ? hash : 1U;
+}
+
+bool z_log_source_dedup_check(union log_msg_generic *msg)
+{
+	struct log_source_dynamic_data *source;
+	struct log_source_limit *limit;
+	struct limit_report rep = { 0 };
+	k_spinlock_key_t key;
+	uint32_t hash;
+	uint32_t now;
+	uint8_t level;
+	bool ret = true;
+
+	if (!z_log_item_is_msg(msg) || (log_msg_get_domain(&msg->log) != Z_LOG_LOCAL_DOMAIN_ID) ||
+	    k_is_pre_kernel()) {
+		return true;
+	}
+
+	level = log_msg_get_level(&msg->log);
+	source = (struct log_source_dynamic_data *)log_msg_get_source(&msg->log);
+	if ((level == LOG_LEVEL_NONE) || (source == NULL) || !source->limit.dedup) {
+		return true;
+	}
+
+	limit = &source->limit;
+	hash = msg_hash(&msg->log);
+	now = k_uptime_get_32();
+
+	key = k_spin_lock(&lock);
+	if (hash == limit->last_hash && level == limit->repeat_level &&
+	    (now - limit->repeat_ts) < CONFIG_LOG_SOURCE_DEDUP_PERIOD_MS) {
+		if (limit->repeat_cnt < UINT16_MAX) {
+			limit->repeat_cnt++;
+		}
+		atomic_set(&pending, 1);
+		ret = false;
+	} else {
+		rep.repeat_cnt = limit->repeat_cnt;
+		rep.repeat_level = limit->repeat_level;
+
+		limit->last_hash = hash;
+		limit->repeat_level = level;
+		limit->repeat_ts = now;
+		limit->repeat_cnt = 0U;
+	}
+	k_spin_unlock(&lock, key);
+
+	if (rep.repeat_cnt > 0U) {
+		repeat_report(source, rep.repeat_level, rep.repeat_cnt, msg->log.hdr.timestamp);
+	}
+
+	return ret;
+}
+#endif
+
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+static void ratelimit_refill(struct log_source_limit *limit, uint32_t now)
+{
+	uint32_t add = (uint32_t)(((uint64_t)(now - limit->refill_ts) * limit->rate) /
+				  MSEC_PER_SEC);
+
+	if (add == 0U) {
+		return;
+	}
+
+	if (limit->tokens + add >= limit->burst) {
+		limit->tokens = limit->burst;
+		limit->refill_ts = now;
+	} else {
+		/* Keep the remainder so that low rates are not rounded down. */
+		limit->tokens += add;
+		limit->refill_ts += (add * MSEC_PER_SEC) / limit->rate;
+	}
+}
+
+static bool ratelimit_check(struct log_source_limit *limit, uint32_t now,
+			    struct limit_report *rep)
+{
+	ratelimit_refill(limit, now);
+
+	if (limit->tokens == 0U) {
+		limit->dropped++;
+		atomic_set(&pending, 1);
+		return false;
+	}
+
+	limit->tokens--;
+	rep->dropped = limit->dropped;
+	limit->dropped = 0U;
+
+	return true;
+}
+#endif
+
+static void limit_report(const void *source, const struct limit_report *rep)
+{
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+	if (rep->repeat_cnt > 0U) {
+		repeat_report(source, rep->repeat_level, rep->repeat_cnt, z_log_timestamp());
+	}
+#endif
+
+	if (rep->dropped > 0U) {
+		z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, LOG_LEVEL_WRN,
+					 NULL, 0, 0, "%u messages dropped by rate limit",
+					 rep->dropped);
+	}
+}
+
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+bool z_log_source_limit_check(const void *source)
+{
+	struct log_source_limit *limit;
+	struct limit_report rep = { 0 };
+	k_spinlock_key_t key;
+	uint32_t now;
+	bool ret = true;
+
+	/* System clock is not running yet. */
+	if (source == NULL || k_is_pre_kernel()) {
+		return true;
+	}
+
+	limit = &((struct log_source_dynamic_data *)source)->limit;
+	now = k_uptime_get_32();
+
+	key = k_spin_lock(&lock);
+	if (limit->rate > 0U) {
+		ret = ratelimit_check(limit, now, &rep);
+	}
+	k_spin_unlock(&lock, key);
+
+	limit_report(source, &rep);
+
+	return ret;
+}
+#endif
+
+bool z_log_source_limit_flush(void)
+{
+	uint32_t now = k_uptime_get_32();
+	bool still_pending = false;
+
+	if (!atomic_get(&pending)) {
+		return false;
+	}
+
+	if ((now - last_flush) < Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS) {
+		return true;
+	}
+
+	last_flush = now;
+	atomic_clear(&pending);
+
+	for (int16_t i = 0; i < z_log_sources_count(); i++) {
+		struct log_source_limit *limit = limit_get(i);
+		struct limit_report rep = { 0 };
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+		if (limit->repeat_cnt > 0U) {
+			if ((now - limit->repeat_ts) >= CONFIG_LOG_SOURCE_DEDUP_PERIOD_MS) {
+				rep.repeat_cnt = limit->repeat_cnt;
+				rep.repeat_level = limit->repeat_level;
+				limit->repeat_cnt = 0U;
+				limit->last_hash = 0U;
+			} else {
+				still_pending = true;
+			}
+		}
+#endif
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+		if (limit->dropped > 0U) {
+			ratelimit_refill(limit, now);
+			if (limit->tokens > 0U || limit->rate == 0U) {
+				rep.dropped = limit->dropped;
+				limit->dropped = 0U;
+			} else {
+				still_pending = true;
+			}
+		}
+#endif
+		k_spin_unlock(&lock, key);
+
+		limit_report(&TYPE_SECTION_START(log_dynamic)[i], &rep);
+	}
+
+	if (still_pending) {
+		atomic_set(&pending, 1);
+	}
+
+	return atomic_get(&pending) != 0;
+}
+
+void z_log_source_limit_init(void)
+{
+	for (int16_t i = 0; i < z_log_sources_count(); i++) {
+		struct log_source_limit *limit = limit_get(i);
+
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+		limit->dedup = IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP_DEFAULT);
+#endif
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+		limit->rate = CONFIG_LOG_SOURCE_RATELIMIT_RATE;
+		limit->burst = CONFIG_LOG_SOURCE_RATELIMIT_BURST;
+		limit->tokens = limit->burst;
+#endif
+	}
+}
+
+int log_source_ratelimit_set(uint32_t domain_id, int16_t source_id,
+			     uint16_t rate, uint16_t burst)
+{
+	int err = source_check(domain_id, source_id);
+
+	if (!IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT)) {
+		return -ENOTSUP;
+	}
+
+	if (err < 0) {
+		return err;
+	}
+
+	if (burst == 0U) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+	struct log_source_limit *limit = limit_get(source_id);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	limit->rate = rate;
+	limit->burst = burst;
+	limit->tokens = burst;
+	limit->refill_ts = k_uptime_get_32();
+	k_spin_unlock(&lock, key);
+#endif
+
+	return 0;
+}
+
+int log_source_ratelimit_get(uint32_t domain_id, int16_t source_id,
+			     uint16_t *rate, uint16_t *burst)
+{
+	int err = source_check(domain_id, source_id);
+
+	if (!IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT)) {
+		return -ENOTSUP;
+	}
+
+	if (err < 0) {
+		return err;
+	}
+
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+	*rate = limit_get(source_id)->rate;
+	*burst = limit_get(source_id)->burst;
+#endif
+
+	return 0;
+}
+
+int log_source_dedup_set(uint32_t domain_id, int16_t source_id, bool enable)
+{
+	int err = source_check(domain_id, source_id);
+
+	if (!IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) {
+		return -ENOTSUP;
+	}
+
+	if (err < 0) {
+		return err;
+	}
+
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+	struct log_source_limit *limit = limit_get(source_id);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	limit->dedup = enable;
+	limit->last_hash = 0U;
+	k_spin_unlock(&lock, key);
+#endif
+
+	return 0;
+}
+
+bool log_source_dedup_get(uint32_t domain_id, int16_t source_id)
+{
+#ifdef CONFIG_LOG_SOURCE_DEDUP
+	if (source_check(domain_id, source_id) == 0) {
+		return limit_get(source_id)->dedup;
+	}
+#endif
+
+	return false;
+}
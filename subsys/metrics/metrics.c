@@ -0,0 +1,134 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/metrics/metrics.h>
+
+BUILD_ASSERT(METRICS_HISTOGRAM_SUB_BITS < METRICS_HISTOGRAM_MAX_BITS);
+
+/* Only serializes readers, writers never take it. */
+static struct k_spinlock lock;
+
+uint32_t metrics_histogram_bucket_max(uint32_t index)
+{
+	uint32_t sub_cnt = BIT(METRICS_HISTOGRAM_SUB_BITS);
+	uint32_t shift;
+	uint64_t lower;
+
+	if (index >= METRICS_HISTOGRAM_BUCKETS - 1) {
+		return UINT32_MAX;
+	}
+
+	if (index < sub_cnt) {
+		return index;
+	}
+
+	shift = (index >> METRICS_HISTOGRAM_SUB_BITS) - 1U;
+	lower = (uint64_t)(sub_cnt + (index & (sub_cnt - 1U))) << shift;
+
+	return (uint32_t)(lower + BIT64(shift) - 1U);
+}
+
+uint64_t metrics_counter_get(struct metrics_counter *counter)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint64_t total;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		unsigned long now = (unsigned long)atomic_get(&counter->cpu[i].value);
+
+		counter->total += (unsigned long)(now - counter->last[i]);
+		counter->last[i] = now;
+	}
+
+	total = counter->total;
+	k_spin_unlock(&lock, key);
+
+	return total;
+}
+
+void metrics_counter_reset(struct metrics_counter *counter)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		counter->last[i] = (unsigned long)atomic_get(&counter->cpu[i].value);
+	}
+
+	counter->total = 0U;
+	k_spin_unlock(&lock, key);
+}
+
+void metrics_histogram_snapshot(struct metrics_histogram *histogram,
+				struct metrics_histogram_snapshot *snapshot)
+{
+	k_spinlock_key_t key;
+
+	memset(snapshot, 0, sizeof(*snapshot));
+
+	key = k_spin_lock(&lock);
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct metrics_histogram_cpu *cpu = &histogram->cpu[i];
+		unsigned long sum = (unsigned long)atomic_get(&cpu->sum);
+
+		for (unsigned int b = 0; b < METRICS_HISTOGRAM_BUCKETS; b++) {
+			snapshot->buckets[b] += (unsigned long)atomic_get(&cpu->buckets[b]);
+		}
+
+		histogram->sum += (unsigned long)(sum - histogram->last_sum[i]);
+		histogram->last_sum[i] = sum;
+	}
+
+	snapshot->sum = histogram->sum;
+	k_spin_unlock(&lock, key);
+
+	for (unsigned int b = 0; b < METRICS_HISTOGRAM_BUCKETS; b++) {
+		snapshot->count += snapshot->buckets[b];
+	}
+}
+
+void metrics_histogram_reset(struct metrics_histogram *histogram)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct metrics_histogram_cpu *cpu = &histogram->cpu[i];
+
+		for (unsigned int b = 0; b < METRICS_HISTOGRAM_BUCKETS; b++) {
+			atomic_clear(&cpu->buckets[b]);
+		}
+
+		histogram->last_sum[i] = (unsigned long)atomic_get(&cpu->sum);
+	}
+
+	histogram->sum = 0U;
+	k_spin_unlock(&lock, key);
+}
+
+struct metrics_counter *metrics_counter_get_by_name(const char *name)
+{
+	STRUCT_SECTION_FOREACH(metrics_counter, counter) {
+		if (strcmp(counter->name, name) == 0) {
+			return counter;
+		}
+	}
+
+	return NULL;
+}
+
+struct metrics_histogram *metrics_histogram_get_by_name(const char *name)
+{
+	STRUCT_SECTION_FOREACH(metrics_histogram, histogram) {
+		if (strcmp(histogram->name, name) == 0) {
+			return histogram;
+		}
+	}
+
+	return NULL;
+}
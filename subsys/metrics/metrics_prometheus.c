@@ -0,0 +1,100 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/metrics/metrics.h>
+#include <zephyr/net/prometheus/collector.h>
+
+/* Metrics are only aggregated when the collector is scraped, the Prometheus
+ * counters and histograms embedded in each metric are refreshed from the
+ * scrape callback.
+ */
+static int metrics_prometheus_scrape(struct prometheus_collector *collector,
+				     struct prometheus_metric *metric, void *user_data)
+{
+	ARG_UNUSED(collector);
+	ARG_UNUSED(user_data);
+
+	if (metric->type == PROMETHEUS_COUNTER) {
+		struct metrics_counter *counter = metric->user_data;
+
+		/* Not prometheus_counter_set(), a reset from the shell makes
+		 * the value go down.
+		 */
+		counter->prom.value = metrics_counter_get(counter);
+
+	} else if (metric->type == PROMETHEUS_HISTOGRAM) {
+		struct metrics_histogram *histogram = metric->user_data;
+		struct metrics_histogram_snapshot snapshot;
+		unsigned long count = 0U;
+
+		metrics_histogram_snapshot(histogram, &snapshot);
+
+		for (unsigned int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+			count += snapshot.buckets[i];
+			histogram->prom_buckets[i].count = count;
+		}
+
+		histogram->prom.sum = (double)snapshot.sum;
+		histogram->prom.count = count;
+
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+PROMETHEUS_COLLECTOR_DEFINE(zephyr_metrics, metrics_prometheus_scrape);
+
+struct prometheus_collector *metrics_prometheus_collector(void)
+{
+	return &zephyr_metrics;
+}
+
+static void metric_init(struct prometheus_metric *base, enum prometheus_metric_type type,
+			const char *name, const char *description, void *user_data)
+{
+	base->type = type;
+	base->name = name;
+	base->description = description;
+	base->labels[0].key = "board";
+	base->labels[0].value = CONFIG_BOARD;
+	base->num_labels = 1;
+	base->collector = &zephyr_metrics;
+	base->user_data = user_data;
+
+	(void)prometheus_collector_register_metric(&zephyr_metrics, base);
+}
+
+static int metrics_prometheus_init(void)
+{
+	STRUCT_SECTION_FOREACH(metrics_counter, counter) {
+		metric_init(&counter->prom.base, PROMETHEUS_COUNTER, counter->name,
+			    counter->description, counter);
+	}
+
+	STRUCT_SECTION_FOREACH(metrics_histogram, histogram) {
+		for (unsigned int i = 0; i < METRICS_HISTOGRAM_BUCKETS - 1; i++) {
+			histogram->prom_buckets[i].upper_bound =
+				(double)metrics_histogram_bucket_max(i);
+		}
+
+		histogram->prom_buckets[METRICS_HISTOGRAM_BUCKETS - 1].upper_bound = INFINITY;
+		histogram->prom.buckets = histogram->prom_buckets;
+		histogram->prom.num_buckets = METRICS_HISTOGRAM_BUCKETS;
+
+		metric_init(&histogram->prom.base, PROMETHEUS_HISTOGRAM, histogram->name,
+			    histogram->description, histogram);
+	}
+
+	return 0;
+}
+
+SYS_INIT(metrics_prometheus_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
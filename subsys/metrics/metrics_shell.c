@@ -0,0 +1,111 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/metrics/metrics.h>
+#include <zephyr/shell/shell.h>
+
+static int cmd_metrics_list(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	STRUCT_SECTION_FOREACH(metrics_counter, counter) {
+		shell_print(sh, "%-32s %" PRIu64, counter->name, metrics_counter_get(counter));
+	}
+
+	STRUCT_SECTION_FOREACH(metrics_histogram, histogram) {
+		struct metrics_histogram_snapshot snapshot;
+
+		metrics_histogram_snapshot(histogram, &snapshot);
+		shell_print(sh, "%-32s count %" PRIu64 " avg %" PRIu64, histogram->name,
+			    snapshot.count,
+			    snapshot.count > 0U ? snapshot.sum / snapshot.count : 0U);
+	}
+
+	return 0;
+}
+
+static int cmd_metrics_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct metrics_histogram_snapshot snapshot;
+	struct metrics_histogram *histogram;
+	struct metrics_counter *counter;
+
+	ARG_UNUSED(argc);
+
+	counter = metrics_counter_get_by_name(argv[1]);
+	if (counter != NULL) {
+		shell_print(sh, "%s: %s", counter->name, counter->description);
+		shell_print(sh, "%" PRIu64, metrics_counter_get(counter));
+		return 0;
+	}
+
+	histogram = metrics_histogram_get_by_name(argv[1]);
+	if (histogram == NULL) {
+		shell_error(sh, "Metric %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	metrics_histogram_snapshot(histogram, &snapshot);
+
+	shell_print(sh, "%s: %s", histogram->name, histogram->description);
+	shell_print(sh, "count %" PRIu64 " sum %" PRIu64, snapshot.count, snapshot.sum);
+
+	for (uint32_t i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+		uint32_t min = (i == 0U) ? 0U : metrics_histogram_bucket_max(i - 1U) + 1U;
+
+		if (snapshot.buckets[i] == 0U) {
+			continue;
+		}
+
+		if (i == METRICS_HISTOGRAM_BUCKETS - 1) {
+			shell_print(sh, "%10u - %-10s %lu", min, "inf", snapshot.buckets[i]);
+		} else {
+			shell_print(sh, "%10u - %-10u %lu", min, metrics_histogram_bucket_max(i),
+				    snapshot.buckets[i]);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_metrics_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	bool found = false;
+
+	STRUCT_SECTION_FOREACH(metrics_counter, counter) {
+		if (argc < 2 || strcmp(argv[1], counter->name) == 0) {
+			metrics_counter_reset(counter);
+			found = true;
+		}
+	}
+
+	STRUCT_SECTION_FOREACH(metrics_histogram, histogram) {
+		if (argc < 2 || strcmp(argv[1], histogram->name) == 0) {
+			metrics_histogram_reset(histogram);
+			found = true;
+		}
+	}
+
+	if (argc >= 2 && !found) {
+		shell_error(sh, "Metric %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_metrics,
+	SHELL_CMD_ARG(list, NULL, "List all metrics", cmd_metrics_list, 1, 0),
+	SHELL_CMD_ARG(show, NULL, "<name> Show a metric, with histogram buckets",
+		      cmd_metrics_show, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "[<name>] Reset one or all metrics", cmd_metrics_reset, 1, 1),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(metrics, &sub_metrics, "Hot path metrics", NULL);
@@ -495,7 +495,7 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 		if (ctx != NULL) {
 			return IMG_MGMT_ERR_FLASH_CONTEXT_ALREADY_SET;
 		}
-		ctx = k_malloc(sizeof(struct flash_img_context));
+		ctx = k_calloc(1, sizeof(struct flash_img_context));
 
 		if (ctx == NULL) {
 			return IMG_MGMT_ERR_NO_FREE_MEMORY;
@@ -45,16 +45,10 @@ static bool modem_backend_uart_async_is_open(struct modem_backend_uart *backend)
 			       MODEM_BACKEND_UART_ASYNC_STATE_OPEN_BIT);
 }
 
-static uint32_t get_receive_buf_length(struct modem_backend_uart *backend)
-{
-	return ring_buf_size_get(&backend->async.receive_rb);
-}
-
 static void modem_backend_uart_async_event_handler(const struct device *dev,
 						   struct uart_event *evt, void *user_data)
 {
 	struct modem_backend_uart *backend = (struct modem_backend_uart *) user_data;
-	k_spinlock_key_t key;
 	uint32_t received;
 
 	switch (evt->type) {
@@ -113,23 +107,16 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 		break;
 
 	case UART_RX_RDY:
-		key = k_spin_lock(&backend->async.receive_rb_lock);
-		received = ring_buf_put(&backend->async.receive_rb,
-					&evt->data.rx.buf[evt->data.rx.offset],
-					evt->data.rx.len);
+		/* The event handler is the only producer, so no lock is needed */
+		received = ring_buf_spsc_put(&backend->async.receive_rb,
+					     &evt->data.rx.buf[evt->data.rx.offset],
+					     evt->data.rx.len);
 
 		if (received < evt->data.rx.len) {
-			const unsigned int buf_size = get_receive_buf_length(backend);
-
-			ring_buf_reset(&backend->async.receive_rb);
-			k_spin_unlock(&backend->async.receive_rb_lock, key);
-
-			LOG_WRN("Receive buffer overrun (dropped %u + %u)",
-				buf_size - received, (unsigned int)evt->data.rx.len);
-			break;
+			LOG_WRN("Receive buffer overrun (dropped %u)",
+				(unsigned int)(evt->data.rx.len - received));
 		}
 
-		k_spin_unlock(&backend->async.receive_rb_lock, key);
 		modem_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
 		break;
 
@@ -157,7 +144,7 @@ static int modem_backend_uart_async_open(void *data)
 	int ret;
 
 	atomic_clear(&backend->async.common.state);
-	ring_buf_reset(&backend->async.receive_rb);
+	ring_buf_spsc_reset(&backend->async.receive_rb);
 
 	ret = pm_device_runtime_get(backend->uart);
 	if (ret < 0) {
@@ -189,9 +176,14 @@ static int modem_backend_uart_async_open(void *data)
 }
 
 #if CONFIG_MODEM_STATS
+static uint32_t get_receive_buf_length(struct modem_backend_uart *backend)
+{
+	return ring_buf_spsc_size_get(&backend->async.receive_rb);
+}
+
 static uint32_t get_receive_buf_size(struct modem_backend_uart *backend)
 {
-	return ring_buf_capacity_get(&backend->async.receive_rb);
+	return ring_buf_spsc_capacity_get(&backend->async.receive_rb);
 }
 
 static void advertise_transmit_buf_stats(struct modem_backend_uart *backend, uint32_t length)
@@ -251,21 +243,15 @@ static int modem_backend_uart_async_transmit(void *data, const uint8_t *buf, siz
 static int modem_backend_uart_async_receive(void *data, uint8_t *buf, size_t size)
 {
 	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
-	k_spinlock_key_t key;
 	uint32_t received;
-	bool empty;
-
-	key = k_spin_lock(&backend->async.receive_rb_lock);
 
 #if CONFIG_MODEM_STATS
 	advertise_receive_buf_stats(backend);
 #endif
 
-	received = ring_buf_get(&backend->async.receive_rb, buf, size);
-	empty = ring_buf_is_empty(&backend->async.receive_rb);
-	k_spin_unlock(&backend->async.receive_rb_lock, key);
+	received = ring_buf_spsc_get(&backend->async.receive_rb, buf, size);
 
-	if (!empty) {
+	if (!ring_buf_spsc_is_empty(&backend->async.receive_rb)) {
 		modem_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
 	}
 
@@ -347,8 +333,8 @@ int modem_backend_uart_async_init(struct modem_backend_uart *backend,
 	backend->async.receive_bufs[1] = &config->receive_buf[receive_buf_size_quarter];
 
 	/* Use half the receive buffer for the received data ring buffer */
-	ring_buf_init(&backend->async.receive_rb, (receive_buf_size_quarter * 2),
-		      &config->receive_buf[receive_buf_size_quarter * 2]);
+	ring_buf_spsc_init(&backend->async.receive_rb, (receive_buf_size_quarter * 2),
+			   &config->receive_buf[receive_buf_size_quarter * 2]);
 
 	backend->async.common.transmit_buf = config->transmit_buf;
 	backend->async.common.transmit_buf_size = config->transmit_buf_size;
@@ -24,37 +24,45 @@ static void modem_backend_uart_isr_flush(struct modem_backend_uart *backend)
 
 static void modem_backend_uart_isr_irq_handler_receive_ready(struct modem_backend_uart *backend)
 {
-	uint32_t size;
-	struct ring_buf *receive_rb;
-	uint8_t *buffer;
+	struct ring_buf_spsc *receive_rb = &backend->isr.receive_rb;
+	struct ring_buf_spsc_vec vec[2];
+	uint32_t received = 0;
 	int ret;
 
-	receive_rb = &backend->isr.receive_rdb[backend->isr.receive_rdb_used];
-	size = ring_buf_put_claim(receive_rb, &buffer, UINT32_MAX);
-	if (size == 0) {
+	if (ring_buf_spsc_put_claim(receive_rb, vec, UINT32_MAX) == 0) {
 		/* This can be caused by
 		 * - a too long CONFIG_MODEM_BACKEND_UART_ISR_RECEIVE_IDLE_TIMEOUT_MS
 		 * - or a too small receive_buf_size
 		 * relatively to the (too high) baud rate and amount of incoming data.
 		 */
 		LOG_WRN("Receive buffer overrun");
-		ring_buf_put_finish(receive_rb, 0);
-		ring_buf_reset(receive_rb);
-		size = ring_buf_put_claim(receive_rb, &buffer, UINT32_MAX);
+		modem_backend_uart_isr_flush(backend);
+		modem_work_reschedule(&backend->receive_ready_work, K_NO_WAIT);
+		return;
+	}
+
+	/* Read straight into the free space, which may wrap around */
+	for (size_t i = 0; i < ARRAY_SIZE(vec) && vec[i].len > 0; i++) {
+		ret = uart_fifo_read(backend->uart, vec[i].data, vec[i].len);
+		if (ret <= 0) {
+			break;
+		}
+
+		received += (uint32_t)ret;
+		if ((uint32_t)ret < vec[i].len) {
+			break;
+		}
 	}
 
-	ret = uart_fifo_read(backend->uart, buffer, size);
-	if (ret <= 0) {
-		ring_buf_put_finish(receive_rb, 0);
+	if (received == 0) {
 		return;
 	}
-	ring_buf_put_finish(receive_rb, (uint32_t)ret);
 
-	if (ring_buf_space_get(receive_rb) > ring_buf_capacity_get(receive_rb) / 20) {
+	ring_buf_spsc_put_finish(receive_rb, received);
+
+	if (ring_buf_spsc_space_get(receive_rb) > ring_buf_spsc_capacity_get(receive_rb) / 20) {
 		/*
 		 * Avoid having the receiver call modem_pipe_receive() too often (e.g. every byte).
-		 * It temporarily disables the UART RX IRQ when swapping buffers
-		 * which can cause byte loss at higher baud rates.
 		 */
 		modem_work_schedule(&backend->receive_ready_work,
 				    K_MSEC(CONFIG_MODEM_BACKEND_UART_ISR_RECEIVE_IDLE_TIMEOUT_MS));
@@ -66,25 +74,18 @@ static void modem_backend_uart_isr_irq_handler_receive_ready(struct modem_backen
 
 static void modem_backend_uart_isr_irq_handler_transmit_ready(struct modem_backend_uart *backend)
 {
-	uint32_t size;
-	uint8_t *buffer;
+	struct ring_buf_spsc_vec vec[2];
 	int ret;
 
-	if (ring_buf_is_empty(&backend->isr.transmit_rb) == true) {
+	if (ring_buf_spsc_get_claim(&backend->isr.transmit_rb, vec, UINT32_MAX) == 0) {
 		uart_irq_tx_disable(backend->uart);
 		modem_work_submit(&backend->transmit_idle_work);
 		return;
 	}
 
-	size = ring_buf_get_claim(&backend->isr.transmit_rb, &buffer, UINT32_MAX);
-	ret = uart_fifo_fill(backend->uart, buffer, size);
-	if (ret < 0) {
-		ring_buf_get_finish(&backend->isr.transmit_rb, 0);
-	} else {
-		ring_buf_get_finish(&backend->isr.transmit_rb, (uint32_t)ret);
-
-		/* Update transmit buf capacity tracker */
-		atomic_sub(&backend->isr.transmit_buf_len, (uint32_t)ret);
+	ret = uart_fifo_fill(backend->uart, vec[0].data, vec[0].len);
+	if (ret > 0) {
+		ring_buf_spsc_get_finish(&backend->isr.transmit_rb, (uint32_t)ret);
 	}
 }
 
@@ -110,10 +111,8 @@ static int modem_backend_uart_isr_open(void *data)
 	int ret;
 	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
 
-	ring_buf_reset(&backend->isr.receive_rdb[0]);
-	ring_buf_reset(&backend->isr.receive_rdb[1]);
-	ring_buf_reset(&backend->isr.transmit_rb);
-	atomic_set(&backend->isr.transmit_buf_len, 0);
+	ring_buf_spsc_reset(&backend->isr.receive_rb);
+	ring_buf_spsc_reset(&backend->isr.transmit_rb);
 
 	ret = pm_device_runtime_get(backend->uart);
 	if (ret < 0) {
@@ -133,25 +132,24 @@ static int modem_backend_uart_isr_open(void *data)
 
 static uint32_t get_transmit_buf_length(struct modem_backend_uart *backend)
 {
-	return atomic_get(&backend->isr.transmit_buf_len);
+	return ring_buf_spsc_capacity_get(&backend->isr.transmit_rb) -
+	       ring_buf_spsc_space_get(&backend->isr.transmit_rb);
 }
 
 #if CONFIG_MODEM_STATS
 static uint32_t get_receive_buf_length(struct modem_backend_uart *backend)
 {
-	return ring_buf_size_get(&backend->isr.receive_rdb[0]) +
-	       ring_buf_size_get(&backend->isr.receive_rdb[1]);
+	return ring_buf_spsc_size_get(&backend->isr.receive_rb);
 }
 
 static uint32_t get_receive_buf_size(struct modem_backend_uart *backend)
 {
-	return ring_buf_capacity_get(&backend->isr.receive_rdb[0]) +
-	       ring_buf_capacity_get(&backend->isr.receive_rdb[1]);
+	return ring_buf_spsc_capacity_get(&backend->isr.receive_rb);
 }
 
 static uint32_t get_transmit_buf_size(struct modem_backend_uart *backend)
 {
-	return ring_buf_capacity_get(&backend->isr.transmit_rb);
+	return ring_buf_spsc_capacity_get(&backend->isr.transmit_rb);
 }
 
 static void advertise_transmit_buf_stats(struct modem_backend_uart *backend)
@@ -166,9 +164,7 @@ static void advertise_receive_buf_stats(struct modem_backend_uart *backend)
 {
 	uint32_t length;
 
-	uart_irq_rx_disable(backend->uart);
 	length = get_receive_buf_length(backend);
-	uart_irq_rx_enable(backend->uart);
 	modem_stats_buffer_advertise_length(&backend->receive_buf_stats, length);
 }
 #endif
@@ -187,13 +183,9 @@ static int modem_backend_uart_isr_transmit(void *data, const uint8_t *buf, size_
 		return 0;
 	}
 
-	uart_irq_tx_disable(backend->uart);
-	written = ring_buf_put(&backend->isr.transmit_rb, buf, size);
+	written = ring_buf_spsc_put(&backend->isr.transmit_rb, buf, size);
 	uart_irq_tx_enable(backend->uart);
 
-	/* Update transmit buf capacity tracker */
-	atomic_add(&backend->isr.transmit_buf_len, written);
-
 #if CONFIG_MODEM_STATS
 	advertise_transmit_buf_stats(backend);
 #endif
@@ -206,35 +198,14 @@ static int modem_backend_uart_isr_receive(void *data, uint8_t *buf, size_t size)
 	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
 
 	uint32_t read_bytes;
-	uint8_t receive_rdb_unused;
 
 #if CONFIG_MODEM_STATS
 	advertise_receive_buf_stats(backend);
 #endif
 
-	read_bytes = 0;
-	receive_rdb_unused = (backend->isr.receive_rdb_used == 1) ? 0 : 1;
-
-	/* Read data from unused ring double buffer first */
-	read_bytes += ring_buf_get(&backend->isr.receive_rdb[receive_rdb_unused], buf, size);
+	read_bytes = ring_buf_spsc_get(&backend->isr.receive_rb, buf, size);
 
-	if (ring_buf_is_empty(&backend->isr.receive_rdb[receive_rdb_unused]) == false) {
-		/* More data available in the buffer */
-		k_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
-		return (int)read_bytes;
-	}
-
-	/* Swap receive ring double buffer */
-	uart_irq_rx_disable(backend->uart);
-	backend->isr.receive_rdb_used = receive_rdb_unused;
-	uart_irq_rx_enable(backend->uart);
-
-	/* Read data from previously used buffer */
-	receive_rdb_unused = (backend->isr.receive_rdb_used == 1) ? 0 : 1;
-
-	read_bytes += ring_buf_get(&backend->isr.receive_rdb[receive_rdb_unused], &buf[read_bytes],
-				   (size - read_bytes));
-	if (ring_buf_is_empty(&backend->isr.receive_rdb[receive_rdb_unused]) == false) {
+	if (ring_buf_spsc_is_empty(&backend->isr.receive_rb) == false) {
 		/* More data available in the buffer */
 		k_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
 	}
@@ -288,23 +259,14 @@ static void init_stats(struct modem_backend_uart *backend)
 void modem_backend_uart_isr_init(struct modem_backend_uart *backend,
 				 const struct modem_backend_uart_config *config)
 {
-	uint32_t receive_double_buf_size;
-
 	backend->isr.transmit_buf_put_limit =
 		config->transmit_buf_size - (config->transmit_buf_size / 4);
 
-	receive_double_buf_size = config->receive_buf_size / 2;
-
-	ring_buf_init(&backend->isr.receive_rdb[0], receive_double_buf_size,
-		      &config->receive_buf[0]);
-
-	ring_buf_init(&backend->isr.receive_rdb[1], receive_double_buf_size,
-		      &config->receive_buf[receive_double_buf_size]);
-
-	ring_buf_init(&backend->isr.transmit_rb, config->transmit_buf_size,
-		      config->transmit_buf);
+	ring_buf_spsc_init(&backend->isr.receive_rb, config->receive_buf_size,
+			   config->receive_buf);
 
-	atomic_set(&backend->isr.transmit_buf_len, 0);
+	ring_buf_spsc_init(&backend->isr.transmit_rb, config->transmit_buf_size,
+			   config->transmit_buf);
 	uart_irq_rx_disable(backend->uart);
 	uart_irq_tx_disable(backend->uart);
 	uart_irq_callback_user_data_set(backend->uart, modem_backend_uart_isr_irq_handler,
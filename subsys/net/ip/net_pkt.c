@@ -38,6 +38,10 @@ LOG_MODULE_REGISTER(net_pkt, CONFIG_NET_PKT_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/udp.h>
 
+#if defined(CONFIG_METRICS_NET)
+#include <zephyr/metrics/metrics.h>
+#endif
+
 #include "net_private.h"
 #include "tcp_internal.h"
 
@@ -128,6 +132,12 @@ BUILD_ASSERT(CONFIG_NET_BUF_DATA_SIZE >= 96);
 #error "Minimum value for CONFIG_NET_BUF_TX_COUNT is 1"
 #endif
 
+#if defined(CONFIG_METRICS_NET)
+METRICS_COUNTER_DEFINE(net_pkt_allocs, "Number of network packets allocated");
+METRICS_COUNTER_DEFINE(net_pkt_alloc_failures, "Number of failed network packet allocations");
+METRICS_COUNTER_DEFINE(net_pkt_frees, "Number of network packets freed");
+#endif
+
 NET_PKT_SLAB_DEFINE(rx_pkts, CONFIG_NET_PKT_RX_COUNT);
 NET_PKT_SLAB_DEFINE(tx_pkts, CONFIG_NET_PKT_TX_COUNT);
 
@@ -616,6 +626,10 @@ done:
 		net_pkt_cursor_init(pkt);
 	}
 
+#if defined(CONFIG_METRICS_NET)
+	metrics_counter_inc(&net_pkt_frees);
+#endif
+
 	k_mem_slab_free(pkt->slab, (void *)pkt);
 }
 
@@ -1488,9 +1502,16 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 
 	ret = k_mem_slab_alloc(slab, (void **)&pkt, timeout);
 	if (ret) {
+#if defined(CONFIG_METRICS_NET)
+		metrics_counter_inc(&net_pkt_alloc_failures);
+#endif
 		return NULL;
 	}
 
+#if defined(CONFIG_METRICS_NET)
+	metrics_counter_inc(&net_pkt_allocs);
+#endif
+
 	memset(pkt, 0, sizeof(struct net_pkt));
 
 	pkt->atomic_ref = ATOMIC_INIT(1);
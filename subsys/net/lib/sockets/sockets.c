@@ -15,6 +15,10 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/net/socket.h>
 #include <zephyr/internal/syscall_handler.h>
 
+#if defined(CONFIG_METRICS_NET)
+#include <zephyr/metrics/metrics.h>
+#endif
+
 #include "sockets_internal.h"
 
 #define VTABLE_CALL(fn, sock, ...)			     \
@@ -44,6 +48,36 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 		retval;					     \
 	})
 
+#if defined(CONFIG_METRICS_NET)
+METRICS_HISTOGRAM_DEFINE(net_socket_send_cycles, "Duration of socket send calls, in cycles");
+METRICS_HISTOGRAM_DEFINE(net_socket_recv_cycles, "Duration of socket receive calls, in cycles");
+METRICS_COUNTER_DEFINE(net_socket_errors, "Number of socket send and receive calls which failed");
+#endif
+
+static inline uint32_t sock_metrics_start(void)
+{
+#if defined(CONFIG_METRICS_NET)
+	return k_cycle_get_32();
+#else
+	return 0;
+#endif
+}
+
+static inline void sock_metrics_update(bool send, uint32_t start, int ret)
+{
+#if defined(CONFIG_METRICS_NET)
+	metrics_histogram_observe(send ? &net_socket_send_cycles : &net_socket_recv_cycles,
+				  k_cycle_get_32() - start);
+	if (ret < 0) {
+		metrics_counter_inc(&net_socket_errors);
+	}
+#else
+	ARG_UNUSED(send);
+	ARG_UNUSED(start);
+	ARG_UNUSED(ret);
+#endif
+}
+
 static inline void *get_sock_vtable(int sock,
 				    const struct socket_op_vtable **vtable,
 				    struct k_mutex **lock)
@@ -334,6 +368,7 @@ static inline int z_vrfy_zsock_accept(int sock, struct net_sockaddr *addr,
 ssize_t z_impl_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 			   const struct net_sockaddr *dest_addr, net_socklen_t addrlen)
 {
+	uint32_t start = sock_metrics_start();
 	int bytes_sent;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendto, sock, len, flags,
@@ -344,6 +379,7 @@ ssize_t z_impl_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendto, sock,
 				       bytes_sent < 0 ? -errno : bytes_sent);
 
+	sock_metrics_update(true, start, bytes_sent);
 	sock_obj_core_update_send_stats(sock, bytes_sent);
 
 	return bytes_sent;
@@ -371,6 +407,7 @@ ssize_t z_vrfy_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 
 ssize_t z_impl_zsock_sendmsg(int sock, const struct net_msghdr *msg, int flags)
 {
+	uint32_t start = sock_metrics_start();
 	int bytes_sent;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock, msg, flags);
@@ -380,6 +417,7 @@ ssize_t z_impl_zsock_sendmsg(int sock, const struct net_msghdr *msg, int flags)
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
 				       bytes_sent < 0 ? -errno : bytes_sent);
 
+	sock_metrics_update(true, start, bytes_sent);
 	sock_obj_core_update_send_stats(sock, bytes_sent);
 
 	return bytes_sent;
@@ -477,6 +515,7 @@ fail:
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct net_sockaddr *src_addr, net_socklen_t *addrlen)
 {
+	uint32_t start = sock_metrics_start();
 	int bytes_received;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvfrom, sock, max_len, flags, src_addr, addrlen);
@@ -487,6 +526,7 @@ ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 				       src_addr, addrlen,
 				       bytes_received < 0 ? -errno : bytes_received);
 
+	sock_metrics_update(false, start, bytes_received);
 	sock_obj_core_update_recv_stats(sock, bytes_received);
 
 	return bytes_received;
@@ -526,6 +566,7 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 
 ssize_t z_impl_zsock_recvmsg(int sock, struct net_msghdr *msg, int flags)
 {
+	uint32_t start = sock_metrics_start();
 	int bytes_received;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock, msg, flags);
@@ -535,6 +576,7 @@ ssize_t z_impl_zsock_recvmsg(int sock, struct net_msghdr *msg, int flags)
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, msg,
 				       bytes_received < 0 ? -errno : bytes_received);
 
+	sock_metrics_update(false, start, bytes_received);
 	sock_obj_core_update_recv_stats(sock, bytes_received);
 
 	return bytes_received;
@@ -10,11 +10,22 @@
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_uart.h>
+#include <zephyr/debug/symtab.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+/* One unique stack trace, frames are ordered from the innermost one */
+struct perf_stack {
+	uint32_t count;
+	uint32_t len;
+	uintptr_t frames[CONFIG_PROFILING_PERF_AGGREGATE_DEPTH];
+};
+#endif
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -22,9 +33,18 @@ struct perf_data_t {
 
 	struct k_work_delayable dwork;
 
+	bool running;
+
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	struct perf_stack stacks[CONFIG_PROFILING_PERF_AGGREGATE_STACKS];
+	size_t stacks_used;
+	uint32_t samples;
+	uint32_t dropped;
+#else
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,6 +54,63 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static uint32_t perf_stack_hash(const uintptr_t *frames, size_t len)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ (uint32_t)frames[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+/*
+ * Samples are merged with previous identical stack traces, so memory usage
+ * depends on the number of distinct traces rather than on the sampling time.
+ */
+static void perf_tracer(struct k_timer *timer)
+{
+	struct perf_data_t *perf_data_ptr =
+		(struct perf_data_t *)k_timer_user_data_get(timer);
+	uintptr_t frames[CONFIG_PROFILING_PERF_AGGREGATE_DEPTH];
+	size_t trace_length;
+	uint32_t hash;
+
+	perf_data_ptr->samples++;
+
+	trace_length = arch_perf_current_stack_trace(frames, ARRAY_SIZE(frames));
+	if (trace_length == 0) {
+		/* Stack deeper than CONFIG_PROFILING_PERF_AGGREGATE_DEPTH */
+		perf_data_ptr->dropped++;
+		return;
+	}
+
+	hash = perf_stack_hash(frames, trace_length);
+
+	for (size_t i = 0; i < ARRAY_SIZE(perf_data_ptr->stacks); i++) {
+		struct perf_stack *stack = &perf_data_ptr->stacks[(hash + i) %
+								  ARRAY_SIZE(perf_data_ptr->stacks)];
+
+		if (stack->count == 0) {
+			memcpy(stack->frames, frames, trace_length * sizeof(frames[0]));
+			stack->len = trace_length;
+			stack->count = 1;
+			perf_data_ptr->stacks_used++;
+			return;
+		}
+
+		if (stack->len == trace_length &&
+		    memcmp(stack->frames, frames, trace_length * sizeof(frames[0])) == 0) {
+			stack->count++;
+			return;
+		}
+	}
+
+	perf_data_ptr->dropped++;
+}
+#else
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
@@ -56,6 +133,16 @@ static void perf_tracer(struct k_timer *timer)
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
+
+static bool perf_buf_full(void)
+{
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	return false;
+#else
+	return perf_data.buf_full;
+#endif
+}
 
 static void perf_dwork_handler(struct k_work *work)
 {
@@ -63,7 +150,8 @@ static void perf_dwork_handler(struct k_work *work)
 	struct perf_data_t *perf_data_ptr = CONTAINER_OF(dwork, struct perf_data_t, dwork);
 
 	k_timer_stop(&perf_data_ptr->timer);
-	if (perf_data_ptr->buf_full) {
+	perf_data_ptr->running = false;
+	if (perf_buf_full()) {
 		shell_error(perf_data_ptr->sh, "Perf buf overflow!");
 	} else {
 		shell_print(perf_data_ptr->sh, "Perf done!");
@@ -72,62 +160,139 @@ static void perf_dwork_handler(struct k_work *work)
 
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_data.running) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
 
-	if (perf_data.buf_full) {
+	if (perf_buf_full()) {
 		shell_warn(sh, "Perf buffer is full");
 		return -ENOBUFS;
 	}
 
-	k_timeout_t duration = K_MSEC(strtoll(argv[1], NULL, 10));
+	int64_t duration_ms = strtoll(argv[1], NULL, 10);
 	k_timeout_t period = K_NSEC(1000000000 / strtoll(argv[2], NULL, 10));
 
+	if (duration_ms == 0 && !IS_ENABLED(CONFIG_PROFILING_PERF_AGGREGATE)) {
+		shell_error(sh, "Continuous recording requires aggregation");
+		return -EINVAL;
+	}
+
 	perf_data.sh = sh;
+	perf_data.running = true;
 
 	k_timer_user_data_set(&perf_data.timer, &perf_data);
 	k_timer_start(&perf_data.timer, K_NO_WAIT, period);
 
-	k_work_schedule(&perf_data.dwork, duration);
+	if (duration_ms != 0) {
+		k_work_schedule(&perf_data.dwork, K_MSEC(duration_ms));
+	}
 
 	shell_print(sh, "Enabled perf");
 
 	return 0;
 }
 
+static int cmd_perf_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	if (!perf_data.running) {
+		shell_warn(sh, "Perf is not running");
+		return -EALREADY;
+	}
+
+	perf_data.sh = sh;
+	k_work_reschedule(&perf_data.dwork, K_NO_WAIT);
+
+	return 0;
+}
+
 static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 {
 	if (sh != NULL) {
-		if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		if (perf_data.running) {
 			shell_warn(sh, "Perf is running");
 			return -EINPROGRESS;
 		}
 		shell_print(sh, "Perf buffer cleared");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	memset(perf_data.stacks, 0, sizeof(perf_data.stacks));
+	perf_data.stacks_used = 0;
+	perf_data.samples = 0;
+	perf_data.dropped = 0;
+#else
 	perf_data.idx = 0;
 	perf_data.buf_full = false;
+#endif
 
 	return 0;
 }
 
 static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_data.running) {
 		shell_print(sh, "Perf is running");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	shell_print(sh, "Perf stacks: %zu/%d, samples: %u, dropped: %u", perf_data.stacks_used,
+		    CONFIG_PROFILING_PERF_AGGREGATE_STACKS, perf_data.samples, perf_data.dropped);
+#else
 	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
 		    perf_data.buf_full ? "(full)" : "");
+#endif
 
 	return 0;
 }
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static void perf_print_frame(const struct shell *sh, uintptr_t addr, const char *sep)
+{
+#ifdef CONFIG_SYMTAB
+	const char *name = symtab_find_symbol_name(addr, NULL);
+
+	if (strcmp(name, "?") != 0) {
+		shell_fprintf(sh, SHELL_NORMAL, "%s%s", sep, name);
+		return;
+	}
+#endif
+	shell_fprintf(sh, SHELL_NORMAL, "%s0x%lx", sep, (unsigned long)addr);
+}
+
+/*
+ * Print one line per unique stack trace in the folded format used by
+ * FlameGraph and compatible tools: "outermost;...;innermost <count>".
+ */
+static int cmd_perf_folded(const struct shell *sh, size_t argc, char **argv)
+{
+	if (perf_data.running) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+	shell_print(sh, "Perf folded stacks %zu", perf_data.stacks_used);
+	for (size_t i = 0; i < ARRAY_SIZE(perf_data.stacks); i++) {
+		const struct perf_stack *stack = &perf_data.stacks[i];
+
+		if (stack->count == 0) {
+			continue;
+		}
+
+		for (size_t j = stack->len; j > 0; j--) {
+			perf_print_frame(sh, stack->frames[j - 1], (j == stack->len) ? "" : ";");
+		}
+		shell_fprintf(sh, SHELL_NORMAL, " %u\n", stack->count);
+	}
+
+	cmd_perf_clear(NULL, 0, NULL);
+
+	return 0;
+}
+#else
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_data.running) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
@@ -141,14 +306,26 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 
 	return 0;
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
+	"A <duration> of 0 records until \"perf stop\" (aggregation only)\n"                     \
 	"Usage: record <duration> <frequency>"
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+#define CMD_PERF_PRINT                                                                             \
+	SHELL_CMD_ARG(folded, NULL, "Print the aggregated stacks in folded format",               \
+		      cmd_perf_folded, 0, 0)
+#else
+#define CMD_PERF_PRINT                                                                             \
+	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0)
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
-	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
+	SHELL_CMD_ARG(stop, NULL, "Stop recording", cmd_perf_stop, 0, 0),
+	CMD_PERF_PRINT,
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
 	SHELL_SUBCMD_SET_END
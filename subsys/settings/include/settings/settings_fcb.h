@@ -24,6 +24,15 @@ extern int settings_fcb_src(struct settings_fcb *cf);
 extern int settings_fcb_dst(struct settings_fcb *cf);
 void settings_mount_fcb_backend(struct settings_fcb *cf);
 
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+/**
+ * Attach a RAM index to a settings FCB, tagging entries with a hash of the
+ * setting name. Must be called after settings_fcb_src().
+ */
+int settings_fcb_index_attach(struct settings_fcb *cf, struct fcb_index_entry *index,
+			      uint16_t size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
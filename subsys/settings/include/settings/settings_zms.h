@@ -72,6 +72,9 @@ extern "C" {
 #define ZMS_DATA_ID_FROM_NAME(x) (x + ZMS_DATA_ID_OFFSET)
 #define ZMS_DATA_ID_FROM_LL_NODE(x) (ZMS_NAME_ID_FROM_LL_NODE(x) + ZMS_DATA_ID_OFFSET)
 
+/* The linked list head has no data entry, its ID holds the batch journal */
+#define ZMS_BATCH_JOURNAL_ID ZMS_DATA_ID_FROM_NAME(ZMS_LL_HEAD_HASH_ID)
+
 struct settings_hash_linked_list {
 	uint32_t previous_hash;
 	uint32_t next_hash;
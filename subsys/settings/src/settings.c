@@ -29,11 +29,116 @@ static K_MUTEX_DEFINE(settings_lock);
 
 void settings_store_init(void);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SETTINGS_HANDLER_INDEX_SIZE),
+	     "CONFIG_SETTINGS_HANDLER_INDEX_SIZE must be a power of two");
+
+#define HANDLER_INDEX_MASK (CONFIG_SETTINGS_HANDLER_INDEX_SIZE - 1)
+
+/* Marks a slot whose handler has been deregistered, probing continues past it */
+#define HANDLER_INDEX_TOMBSTONE ((const struct settings_handler_static *)UINTPTR_MAX)
+
+/*
+ * Open-addressing index of all handlers, hashed on the first element of the
+ * handler name. Every handler matching a given key shares the key's first
+ * name element, so a lookup only has to look at the slots in the probe
+ * sequence of that element.
+ */
+struct handler_index_slot {
+	uint32_t hash;
+	const struct settings_handler_static *handler;
+};
+
+static struct handler_index_slot handler_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static bool handler_index_ready;
+static bool handler_index_full;
+
+/* FNV-1a over the first name element, up to a separator or name end */
+static uint32_t handler_index_hash(const char *name)
+{
+	uint32_t hash = 2166136261U;
+
+	while ((*name != '\0') && (*name != SETTINGS_NAME_END) &&
+	       (*name != SETTINGS_NAME_SEPARATOR)) {
+		hash = (hash ^ (uint8_t)*name) * 16777619U;
+		name++;
+	}
+
+	return hash;
+}
+
+static void handler_index_add(const struct settings_handler_static *handler)
+{
+	uint32_t hash = handler_index_hash(handler->name);
+	uint32_t idx = hash & HANDLER_INDEX_MASK;
+
+	for (size_t i = 0; i < CONFIG_SETTINGS_HANDLER_INDEX_SIZE; i++) {
+		struct handler_index_slot *slot = &handler_index[idx];
+
+		if ((slot->handler == NULL) || (slot->handler == HANDLER_INDEX_TOMBSTONE)) {
+			slot->hash = hash;
+			/* Publish the handler last, lookups are not locked */
+			compiler_barrier();
+			slot->handler = handler;
+			return;
+		}
+
+		idx = (idx + 1) & HANDLER_INDEX_MASK;
+	}
+
+	LOG_WRN("Handler index full, falling back to linear lookup");
+	handler_index_full = true;
+}
+
+#if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
+static void handler_index_remove(const struct settings_handler_static *handler)
+{
+	uint32_t idx = handler_index_hash(handler->name) & HANDLER_INDEX_MASK;
+
+	for (size_t i = 0; i < CONFIG_SETTINGS_HANDLER_INDEX_SIZE; i++) {
+		struct handler_index_slot *slot = &handler_index[idx];
+
+		if (slot->handler == NULL) {
+			return;
+		}
+
+		if (slot->handler == handler) {
+			slot->handler = HANDLER_INDEX_TOMBSTONE;
+			return;
+		}
+
+		idx = (idx + 1) & HANDLER_INDEX_MASK;
+	}
+}
+#endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+
+static void handler_index_init(void)
+{
+	handler_index_ready = false;
+	handler_index_full = false;
+	memset(handler_index, 0, sizeof(handler_index));
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		handler_index_add(ch);
+	}
+
+	handler_index_ready = true;
+}
+
+static bool handler_index_usable(void)
+{
+	return handler_index_ready && !handler_index_full;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 void settings_init(void)
 {
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	handler_index_init();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 	settings_store_init();
 }
 
@@ -61,6 +166,12 @@ int settings_register_with_cprio(struct settings_handler *handler, int cprio)
 	handler->cprio = cprio;
 	sys_slist_append(&settings_handlers, &handler->node);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (handler_index_ready) {
+		handler_index_add((const struct settings_handler_static *)handler);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 end:
 	settings_lock_release();
 	return rc;
@@ -70,6 +181,28 @@ int settings_register(struct settings_handler *handler)
 {
 	return settings_register_with_cprio(handler, 0);
 }
+
+int settings_deregister(struct settings_handler *handler)
+{
+	int rc = 0;
+
+	settings_lock_take();
+
+	if (!sys_slist_find_and_remove(&settings_handlers, &handler->node)) {
+		rc = -ENOENT;
+		goto end;
+	}
+
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (handler_index_ready) {
+		handler_index_remove((const struct settings_handler_static *)handler);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
+end:
+	settings_lock_release();
+	return rc;
+}
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
 
 int settings_name_steq(const char *name, const char *key, const char **next)
@@ -143,6 +276,46 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+static struct settings_handler_static *handler_index_lookup(const char *name,
+							     const char **next)
+{
+	const struct settings_handler_static *bestmatch = NULL;
+	uint32_t hash = handler_index_hash(name);
+	uint32_t idx = hash & HANDLER_INDEX_MASK;
+	const char *tmpnext;
+
+	for (size_t i = 0; i < CONFIG_SETTINGS_HANDLER_INDEX_SIZE; i++) {
+		const struct handler_index_slot *slot = &handler_index[idx];
+		const struct settings_handler_static *ch = slot->handler;
+
+		if (ch == NULL) {
+			break;
+		}
+
+		idx = (idx + 1) & HANDLER_INDEX_MASK;
+
+		if ((ch == HANDLER_INDEX_TOMBSTONE) || (slot->hash != hash)) {
+			continue;
+		}
+
+		if (!settings_name_steq(name, ch->name, &tmpnext)) {
+			continue;
+		}
+
+		/* Prefer the most specific handler, as the linear lookup does */
+		if (!bestmatch || settings_name_steq(ch->name, bestmatch->name, NULL)) {
+			bestmatch = ch;
+			if (next) {
+				*next = tmpnext;
+			}
+		}
+	}
+
+	return (struct settings_handler_static *)bestmatch;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 struct settings_handler_static *settings_parse_and_lookup(const char *name,
 							const char **next)
 {
@@ -154,6 +327,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (name && handler_index_usable()) {
+		return handler_index_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -100,6 +100,60 @@ int settings_fcb_dst(struct settings_fcb *cf)
 	return 0;
 }
 
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+/* FNV-1a over the name part of a "name=value" line */
+static uint32_t settings_fcb_name_hash_update(uint32_t hash, const char *buf, size_t len,
+					      bool *done)
+{
+	for (size_t i = 0; i < len; i++) {
+		if (buf[i] == '=') {
+			*done = true;
+			break;
+		}
+		hash = (hash ^ (uint8_t)buf[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static uint32_t settings_fcb_name_hash(const char *name)
+{
+	bool done = false;
+
+	return settings_fcb_name_hash_update(2166136261U, name, strlen(name), &done);
+}
+
+/* ::f_index_tag callback, reads the entry name straight from flash as the
+ * settings line helpers are not set up yet when fcb_init() builds the index.
+ */
+static uint32_t settings_fcb_index_tag(struct fcb *fcb, const struct fcb_entry *loc)
+{
+	char buf[16];
+	uint32_t hash = 2166136261U;
+	bool done = false;
+	off_t off = 0;
+
+	while (!done && off < loc->fe_data_len) {
+		size_t len = MIN(sizeof(buf), loc->fe_data_len - off);
+
+		if (flash_area_read(fcb->fap, loc->fe_sector->fs_off + loc->fe_data_off + off,
+				    buf, len) != 0) {
+			break;
+		}
+		hash = settings_fcb_name_hash_update(hash, buf, len, &done);
+		off += len;
+	}
+
+	return hash;
+}
+
+int settings_fcb_index_attach(struct settings_fcb *cf, struct fcb_index_entry *index,
+			      uint16_t size)
+{
+	return fcb_index_attach(&cf->cf_fcb, index, size, settings_fcb_index_tag);
+}
+#endif /* CONFIG_SETTINGS_FCB_INDEX */
+
 /**
  * @brief Check if there is any duplicate of the current setting
  *
@@ -118,6 +172,30 @@ static bool settings_fcb_check_duplicate(struct settings_fcb *cf,
 {
 	struct fcb_entry_ctx entry2_ctx = *entry_ctx;
 
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+	uint32_t tag = settings_fcb_name_hash(name);
+	int rc;
+
+	/* Only read names of entries whose tag matches */
+	while ((rc = fcb_index_find(&cf->cf_fcb, tag, &entry2_ctx.loc)) == 0) {
+		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name2_len;
+
+		if (settings_line_name_read(name2, sizeof(name2), &name2_len,
+					    &entry2_ctx)) {
+			LOG_ERR("failed to load line");
+			continue;
+		}
+		name2[name2_len] = '\0';
+		if (!strcmp(name, name2)) {
+			return true;
+		}
+	}
+	if (rc != -ENOENT) {
+		return false;
+	}
+#endif
+
 	while (fcb_getnext(&cf->cf_fcb, &entry2_ctx.loc) == 0) {
 		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name2_len;
@@ -219,9 +297,7 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 	int rc;
 	struct fcb_entry_ctx loc1;
 	struct fcb_entry_ctx loc2;
-	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN];
-	int copy;
+	char name1[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 	uint8_t rbs;
 
 	rc = fcb_append_to_scratch(&cf->cf_fcb);
@@ -256,25 +332,8 @@ static void settings_fcb_compress(struct settings_fcb *cf)
 			continue;
 		}
 
-		loc2 = loc1;
-		copy = 1;
-
-		while (fcb_getnext(&cf->cf_fcb, &loc2.loc) == 0) {
-			size_t val2_off;
-
-			rc = settings_line_name_read(name2, sizeof(name2),
-						     &val2_off, &loc2);
-			if (rc) {
-				continue;
-			}
-
-			if ((val1_off == val2_off) &&
-			    !memcmp(name1, name2, val1_off)) {
-				copy = 0;
-				break;
-			}
-		}
-		if (!copy) {
+		name1[val1_off] = '\0';
+		if (settings_fcb_check_duplicate(cf, &loc1, name1)) {
 			continue;
 		}
 
@@ -364,6 +423,36 @@ static int settings_fcb_save_priv(struct settings_store *cs, const char *name,
 	return rc;
 }
 
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+/* Pass only the entries stored under @p name to @p cb, oldest first */
+static int settings_fcb_load_name(struct settings_fcb *cf, const char *name,
+				  line_load_cb cb, void *cb_arg)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+	uint32_t tag = settings_fcb_name_hash(name);
+	int rc;
+
+	while ((rc = fcb_index_find(&cf->cf_fcb, tag, &entry_ctx.loc)) == 0) {
+		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		size_t name2_len;
+
+		if (settings_line_name_read(name2, sizeof(name2), &name2_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name2[name2_len] = '\0';
+		if (!strcmp(name, name2)) {
+			cb(name2, &entry_ctx, name2_len + 1, cb_arg);
+		}
+	}
+
+	return (rc == -ENOTSUP) ? 0 : rc;
+}
+#endif /* CONFIG_SETTINGS_FCB_INDEX */
+
 static int settings_fcb_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -380,7 +469,16 @@ static int settings_fcb_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+	struct settings_fcb *cf = CONTAINER_OF(cs, struct settings_fcb, cf_store);
+
+	if (!name || settings_fcb_load_name(cf, name, settings_line_dup_check_cb, &cdca) != 0) {
+		cdca.is_dup = 0;
+		settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	}
+#else
 	settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+#endif
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -400,6 +498,9 @@ int settings_backend_init(void)
 {
 	static struct flash_sector
 		settings_fcb_area[CONFIG_SETTINGS_FCB_NUM_AREAS + 1];
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+	static struct fcb_index_entry settings_fcb_index[CONFIG_SETTINGS_FCB_INDEX_SIZE];
+#endif
 	static struct settings_fcb config_init_settings_fcb = {
 		.cf_fcb.f_magic = CONFIG_SETTINGS_FCB_MAGIC,
 		.cf_fcb.f_sectors = settings_fcb_area,
@@ -437,6 +538,14 @@ int settings_backend_init(void)
 		}
 	}
 
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+	rc = settings_fcb_index_attach(&config_init_settings_fcb, settings_fcb_index,
+				       ARRAY_SIZE(settings_fcb_index));
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
 	rc = settings_fcb_dst(&config_init_settings_fcb);
 	if (rc != 0) {
 		return rc;
@@ -29,10 +29,18 @@ static int settings_file_load(struct settings_store *cs,
 static int settings_file_save(struct settings_store *cs, const char *name,
 			      const char *value, size_t val_len);
 static void *settings_file_storage_get(struct settings_store *cs);
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+static int settings_file_save_batch(struct settings_store *cs,
+				    const struct settings_batch_entry *entries,
+				    size_t count);
+#endif
 
 static const struct settings_store_itf settings_file_itf = {
 	.csi_load = settings_file_load,
 	.csi_save = settings_file_save,
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+	.csi_save_batch = settings_file_save_batch,
+#endif
 	.csi_storage_get = settings_file_storage_get
 };
 
@@ -220,12 +228,27 @@ static int settings_file_create_or_replace(struct fs_file_t *zfp,
 	return fs_open(zfp, file_name, FS_O_CREATE | FS_O_RDWR);
 }
 
+static bool settings_file_entries_match(const struct settings_batch_entry *entries,
+					size_t count, const char *name, size_t name_len)
+{
+	for (size_t i = 0; i < count; i++) {
+		if ((strlen(entries[i].name) == name_len) &&
+		    !memcmp(entries[i].name, name, name_len)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /*
- * Try to compress configuration file by keeping unique names only.
+ * Try to compress configuration file by keeping unique names only, and append
+ * the new values. The compressed file replaces the old one with a rename, so
+ * either all or none of the new values end up in the configuration file.
  */
-static int settings_file_save_and_compress(struct settings_file *cf,
-			   const char *name, const char *value,
-			   size_t val_len)
+static int settings_file_compress_with(struct settings_file *cf,
+				       const struct settings_batch_entry *entries,
+				       size_t count)
 {
 	int rc, rc2;
 	struct fs_file_t rf;
@@ -247,7 +270,6 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 
 	int copy;
 	int lines;
-	size_t new_name_len;
 	size_t val1_off;
 
 	fs_file_t_init(&rf);
@@ -265,7 +287,6 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 	}
 
 	lines = 0;
-	new_name_len = strlen(name);
 
 	while (1) {
 		rc = settings_next_line_ctx(&loc1);
@@ -290,8 +311,7 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 		}
 
 		/* avoid copping value which will be overwritten by new value*/
-		if ((val1_off == new_name_len) &&
-		    !memcmp(name1, name, val1_off)) {
+		if (settings_file_entries_match(entries, count, name1, val1_off)) {
 			continue;
 		}
 
@@ -337,11 +357,14 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 		lines++;
 	}
 
-	/* at last store the new value */
-	rc = settings_line_write(name, value, val_len, 0, &loc3);
-	if (rc) {
-		/* compressed file might be corrupted */
-		goto end_rolback;
+	/* at last store the new values */
+	for (size_t i = 0; i < count; i++) {
+		rc = settings_line_write(entries[i].name, entries[i].value,
+					 entries[i].val_len, 0, &loc3);
+		if (rc) {
+			/* compressed file might be corrupted */
+			goto end_rolback;
+		}
 	}
 
 	rc = fs_close(&wf);
@@ -350,7 +373,7 @@ static int settings_file_save_and_compress(struct settings_file *cf,
 		if (fs_rename(tmp_file, cf->cf_name)) {
 			return -ENOENT;
 		}
-		cf->cf_lines = lines + 1;
+		cf->cf_lines = lines + count;
 	} else {
 		rc = -EIO;
 	}
@@ -368,6 +391,19 @@ end_rolback:
 
 }
 
+static int settings_file_save_and_compress(struct settings_file *cf,
+			   const char *name, const char *value,
+			   size_t val_len)
+{
+	const struct settings_batch_entry entry = {
+		.name = name,
+		.value = value,
+		.val_len = val_len,
+	};
+
+	return settings_file_compress_with(cf, &entry, 1);
+}
+
 static int settings_file_save_priv(struct settings_store *cs, const char *name,
 				   const char *value, size_t val_len)
 {
@@ -443,6 +479,43 @@ static int settings_file_save(struct settings_store *cs, const char *name,
 	return settings_file_save_priv(cs, name, value, val_len);
 }
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+/*
+ * Batches are written through the compression path: the file is rewritten
+ * once with all new values appended and then renamed over the old one.
+ * The rewrite is skipped when every value is already stored.
+ */
+static int settings_file_save_batch(struct settings_store *cs,
+				    const struct settings_batch_entry *entries,
+				    size_t count)
+{
+	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
+	struct settings_line_dup_check_arg cdca;
+	bool changed = false;
+
+	for (size_t i = 0; i < count; i++) {
+		if (entries[i].val_len > 0 && entries[i].value == NULL) {
+			return -EINVAL;
+		}
+	}
+
+	for (size_t i = 0; i < count && !changed; i++) {
+		cdca.name = entries[i].name;
+		cdca.val = (char *)entries[i].value;
+		cdca.is_dup = 0;
+		cdca.val_len = entries[i].val_len;
+		settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+		changed = (cdca.is_dup != 1);
+	}
+
+	if (!changed) {
+		return 0;
+	}
+
+	return settings_file_compress_with(cf, entries, count);
+}
+#endif /* CONFIG_SETTINGS_SAVE_BATCH */
+
 static int read_handler(void *ctx, off_t off, char *buf, size_t *len)
 {
 	struct line_entry_ctx *entry_ctx = ctx;
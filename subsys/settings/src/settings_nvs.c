@@ -33,10 +33,18 @@ static int settings_nvs_load(struct settings_store *cs,
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
 static void *settings_nvs_storage_get(struct settings_store *cs);
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+static int settings_nvs_save_batch(struct settings_store *cs,
+				   const struct settings_batch_entry *entries,
+				   size_t count);
+#endif
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
 	.csi_save = settings_nvs_save,
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+	.csi_save_batch = settings_nvs_save_batch,
+#endif
 	.csi_storage_get = settings_nvs_storage_get
 };
 
@@ -87,6 +95,18 @@ static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
 	cf->cache_next %= CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
 }
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+static void settings_nvs_cache_move(struct settings_nvs *cf, uint16_t name_id,
+				    uint16_t new_name_id)
+{
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if (cf->cache[i].name_id == name_id) {
+			cf->cache[i].name_id = new_name_id;
+		}
+	}
+}
+#endif /* CONFIG_SETTINGS_SAVE_BATCH */
+
 static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *name,
 					 char *rdname, size_t len)
 {
@@ -354,11 +374,259 @@ found:
 	return 0;
 }
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+/* Size of the stack buffer used to skip rewriting unchanged values */
+#define SETTINGS_NVS_BATCH_CMP_LEN 32
+
+static int settings_nvs_delete_ids(struct settings_nvs *cf, const uint16_t *ids,
+				   size_t count)
+{
+	int rc;
+
+	for (size_t i = 0; i < count; i++) {
+		rc = nvs_delete(&cf->cf_nvs, ids[i]);
+		if (rc >= 0) {
+			rc = nvs_delete(&cf->cf_nvs, ids[i] + NVS_NAME_ID_OFFSET);
+		}
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Look up the name IDs of all batch entries in one pass over the stored names */
+static int settings_nvs_batch_find(struct settings_nvs *cf,
+				   const struct settings_batch_entry *entries,
+				   size_t count, uint16_t *found_ids)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t missing = count;
+	uint16_t name_id;
+	ssize_t rc;
+
+	for (size_t i = 0; i < count; i++) {
+		found_ids[i] = NVS_NAMECNT_ID;
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		found_ids[i] = settings_nvs_cache_match(cf, entries[i].name, rdname,
+							sizeof(rdname));
+		if (found_ids[i] != NVS_NAMECNT_ID) {
+			missing--;
+		}
+#endif
+	}
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	/* We can skip reading NVS if we know that the cache wasn't overflowed. */
+	if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return 0;
+	}
+#endif
+
+	for (name_id = cf->last_name_id; (name_id > NVS_NAMECNT_ID) && missing; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname));
+		if (rc < 0) {
+			continue;
+		}
+
+		rdname[rc] = '\0';
+
+		for (size_t i = 0; i < count; i++) {
+			if ((found_ids[i] == NVS_NAMECNT_ID) && !strcmp(entries[i].name, rdname)) {
+				found_ids[i] = name_id;
+				missing--;
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static bool settings_nvs_value_unchanged(struct settings_nvs *cf, uint16_t name_id,
+					 const void *value, size_t val_len)
+{
+	uint8_t rdval[SETTINGS_NVS_BATCH_CMP_LEN];
+	ssize_t rc;
+
+	if (val_len > sizeof(rdval)) {
+		return false;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, rdval, sizeof(rdval));
+
+	return (rc == val_len) && !memcmp(rdval, value, val_len);
+}
+
+/*
+ * Batches are committed by writing every new or changed item under a fresh
+ * name ID above last_name_id, where the loader does not look yet. The
+ * NVS_NAMECNT_ID entry is then rewritten once with the new last_name_id,
+ * followed by the IDs the batch superseded. That single write is the commit
+ * point: before it, none of the batch is visible, after it, the superseded
+ * IDs are deleted, either right away or by settings_nvs_backend_init() after
+ * a power loss.
+ */
+static int settings_nvs_save_batch(struct settings_store *cs,
+				   const struct settings_batch_entry *entries,
+				   size_t count)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t found_ids[CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES];
+	uint16_t marker[1 + CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES];
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	uint16_t new_ids[CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES];
+#endif
+	size_t stale_cnt = 0;
+	uint16_t write_name_id = cf->last_name_id;
+	int rc;
+
+	rc = settings_nvs_batch_find(cf, entries, count, found_ids);
+	if (rc < 0) {
+		return rc;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		bool delete = (entries[i].value == NULL) || (entries[i].val_len == 0);
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		new_ids[i] = NVS_NAMECNT_ID;
+#endif
+
+		if (delete) {
+			if (found_ids[i] != NVS_NAMECNT_ID) {
+				marker[1 + stale_cnt++] = found_ids[i];
+			}
+			continue;
+		}
+
+		if ((found_ids[i] != NVS_NAMECNT_ID) &&
+		    settings_nvs_value_unchanged(cf, found_ids[i], entries[i].value,
+						 entries[i].val_len)) {
+			continue;
+		}
+
+		write_name_id++;
+		/* No free IDs left. */
+		if (write_name_id == NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET) {
+			return -ENOMEM;
+		}
+
+		rc = nvs_write(&cf->cf_nvs, write_name_id + NVS_NAME_ID_OFFSET,
+			       entries[i].value, entries[i].val_len);
+		if (rc >= 0) {
+			rc = nvs_write(&cf->cf_nvs, write_name_id, entries[i].name,
+				       strlen(entries[i].name));
+		}
+		if (rc < 0) {
+			return rc;
+		}
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		new_ids[i] = write_name_id;
+#endif
+
+		if (found_ids[i] != NVS_NAMECNT_ID) {
+			marker[1 + stale_cnt++] = found_ids[i];
+		}
+	}
+
+	if ((write_name_id == cf->last_name_id) && (stale_cnt == 0)) {
+		/* Nothing changed */
+		return 0;
+	}
+
+	/* Commit */
+	marker[0] = write_name_id;
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, marker,
+		       (1 + stale_cnt) * sizeof(uint16_t));
+	if (rc < 0) {
+		return rc;
+	}
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	for (size_t i = 0; i < count; i++) {
+		if (new_ids[i] == NVS_NAMECNT_ID) {
+			continue;
+		}
+
+		if (found_ids[i] == NVS_NAMECNT_ID) {
+			settings_nvs_cache_add(cf, entries[i].name, new_ids[i]);
+			if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+				cf->cache_total++;
+			}
+		} else {
+			settings_nvs_cache_move(cf, found_ids[i], new_ids[i]);
+		}
+	}
+#endif
+
+	cf->last_name_id = write_name_id;
+
+	if (stale_cnt == 0) {
+		return 0;
+	}
+
+	rc = settings_nvs_delete_ids(cf, &marker[1], stale_cnt);
+	if (rc < 0) {
+		return rc;
+	}
+
+	/* Drop the superseded IDs from the commit marker */
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id, sizeof(uint16_t));
+
+	return (rc < 0) ? rc : 0;
+}
+
+/* Finish a batch that was interrupted after its commit by deleting the IDs it
+ * superseded, and drop the items of a batch that was interrupted before it.
+ */
+static int settings_nvs_batch_recover(struct settings_nvs *cf, const uint16_t *marker,
+				      ssize_t marker_len)
+{
+	uint16_t name_id;
+	char buf;
+	ssize_t rc1, rc2;
+	int rc;
+
+	/* Uncommitted items sit in consecutive IDs right above last_name_id */
+	for (name_id = cf->last_name_id + 1;
+	     name_id < NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET; name_id++) {
+		rc1 = nvs_read(&cf->cf_nvs, name_id, &buf, sizeof(buf));
+		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+		if ((rc1 <= 0) && (rc2 <= 0)) {
+			break;
+		}
+
+		rc = settings_nvs_delete_ids(cf, &name_id, 1);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	if (marker_len <= (ssize_t)sizeof(uint16_t)) {
+		return 0;
+	}
+
+	rc = settings_nvs_delete_ids(cf, &marker[1], (marker_len / sizeof(uint16_t)) - 1);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id, sizeof(uint16_t));
+
+	return (rc < 0) ? rc : 0;
+}
+#endif /* CONFIG_SETTINGS_SAVE_BATCH */
+
 /* Initialize the nvs backend. */
 int settings_nvs_backend_init(struct settings_nvs *cf)
 {
 	int rc;
-	uint16_t last_name_id;
+	/* The name ID counter, followed by the IDs a batch superseded */
+	uint16_t marker[1 + COND_CODE_1(CONFIG_SETTINGS_SAVE_BATCH,
+					(CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES), (0))];
 
 	cf->cf_nvs.flash_device = cf->flash_dev;
 	if (cf->cf_nvs.flash_device == NULL) {
@@ -370,14 +638,20 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		return rc;
 	}
 
-	rc = nvs_read(&cf->cf_nvs, NVS_NAMECNT_ID, &last_name_id,
-		      sizeof(last_name_id));
+	rc = nvs_read(&cf->cf_nvs, NVS_NAMECNT_ID, marker, sizeof(marker));
 	if (rc < 0) {
 		cf->last_name_id = NVS_NAMECNT_ID;
 	} else {
-		cf->last_name_id = last_name_id;
+		cf->last_name_id = marker[0];
 	}
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+	rc = settings_nvs_batch_recover(cf, marker, MIN(rc, (ssize_t)sizeof(marker)));
+	if (rc < 0) {
+		return rc;
+	}
+#endif
+
 	LOG_DBG("Initialized");
 	return 0;
 }
@@ -225,6 +225,69 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 	return rc;
 }
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+int settings_save_batch(const struct settings_batch_entry *entries, size_t count)
+{
+	int rc = 0;
+	int rc2;
+	struct settings_store *cs;
+
+	cs = settings_save_dst;
+	if (!cs) {
+		return -ENOENT;
+	}
+
+	if (count > CONFIG_SETTINGS_SAVE_BATCH_MAX_ENTRIES) {
+		return -E2BIG;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!entries[i].name) {
+			return -EINVAL;
+		}
+
+		for (size_t j = 0; j < i; j++) {
+			if (!strcmp(entries[i].name, entries[j].name)) {
+				return -EINVAL;
+			}
+		}
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	settings_lock_take();
+
+	if (cs->cs_itf->csi_save_batch) {
+		rc = cs->cs_itf->csi_save_batch(cs, entries, count);
+		goto end;
+	}
+
+	/* Back-end has no atomic batch support, save the items one by one */
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		rc2 = cs->cs_itf->csi_save(cs, entries[i].name, (const char *)entries[i].value,
+					   entries[i].val_len);
+		if (!rc) {
+			rc = rc2;
+		}
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+end:
+	settings_lock_release();
+
+	return rc;
+}
+#endif /* CONFIG_SETTINGS_SAVE_BATCH */
+
 int settings_delete(const char *name)
 {
 	return settings_save_one(name, NULL, 0);
@@ -37,10 +37,17 @@ static int settings_zms_save(struct settings_store *cs, const char *name, const
 static void *settings_zms_storage_get(struct settings_store *cs);
 static int settings_zms_get_last_hash_ids(struct settings_zms *cf);
 static ssize_t settings_zms_get_val_len(struct settings_store *cs, const char *name);
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+static int settings_zms_save_batch(struct settings_store *cs,
+				   const struct settings_batch_entry *entries, size_t count);
+#endif
 
 static struct settings_store_itf settings_zms_itf = {.csi_load = settings_zms_load,
 						     .csi_load_one = settings_zms_load_one,
 						     .csi_save = settings_zms_save,
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+						     .csi_save_batch = settings_zms_save_batch,
+#endif
 						     .csi_storage_get = settings_zms_storage_get,
 						     .csi_get_val_len = settings_zms_get_val_len};
 
@@ -573,6 +580,151 @@ static ssize_t settings_zms_get_val_len(struct settings_store *cs, const char *n
 	return 0;
 }
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+/* Size of the stack buffer used to skip journaling unchanged values */
+#define SETTINGS_ZMS_BATCH_CMP_LEN 32
+
+struct settings_zms_journal_hdr {
+	uint16_t name_len;
+	uint16_t val_len;
+} __packed;
+
+/* Batches are serialized here, and read back here when replaying them */
+static uint8_t settings_zms_journal[CONFIG_SETTINGS_ZMS_BATCH_JOURNAL_SIZE];
+
+static bool settings_zms_value_unchanged(struct settings_zms *cf, const char *name,
+					 const void *value, size_t val_len)
+{
+	uint8_t rdval[SETTINGS_ZMS_BATCH_CMP_LEN];
+	uint32_t name_hash;
+	ssize_t rc;
+
+	if (val_len > sizeof(rdval)) {
+		return false;
+	}
+
+	name_hash = settings_zms_find_hash_from_name(cf, name);
+	if (!name_hash) {
+		/* Deleting a name that does not exist changes nothing */
+		return (value == NULL) || (val_len == 0);
+	}
+
+	if ((value == NULL) || (val_len == 0)) {
+		return false;
+	}
+
+	rc = zms_read(&cf->cf_zms, ZMS_DATA_ID_FROM_HASH(name_hash), rdval, sizeof(rdval));
+
+	return (rc == val_len) && !memcmp(rdval, value, val_len);
+}
+
+/* Apply all items of a journal that has been committed to storage */
+static int settings_zms_journal_apply(struct settings_zms *cf, size_t len)
+{
+	struct settings_zms_journal_hdr hdr;
+	char name[SETTINGS_FULL_NAME_LEN];
+	size_t off = 0;
+	int rc;
+
+	while (off + sizeof(hdr) <= len) {
+		memcpy(&hdr, &settings_zms_journal[off], sizeof(hdr));
+		off += sizeof(hdr);
+
+		if ((hdr.name_len >= sizeof(name)) || (off + hdr.name_len + hdr.val_len > len)) {
+			LOG_ERR("Corrupted batch journal");
+			break;
+		}
+
+		memcpy(name, &settings_zms_journal[off], hdr.name_len);
+		name[hdr.name_len] = '\0';
+		off += hdr.name_len;
+
+		rc = settings_zms_save(&cf->cf_store, name,
+				       hdr.val_len ? (char *)&settings_zms_journal[off] : NULL,
+				       hdr.val_len);
+		if (rc < 0) {
+			return rc;
+		}
+
+		off += hdr.val_len;
+	}
+
+	return zms_delete(&cf->cf_zms, ZMS_BATCH_JOURNAL_ID);
+}
+
+/*
+ * Batches are serialized into a journal that is written to storage as one ZMS
+ * entry, which is the commit point of the batch. The items are then saved one
+ * by one and the journal is deleted. If power is lost while the items are
+ * saved, settings_zms_backend_init() replays the journal. Items whose stored
+ * value is already up to date are left out of the journal.
+ */
+static int settings_zms_save_batch(struct settings_store *cs,
+				   const struct settings_batch_entry *entries, size_t count)
+{
+	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
+	struct settings_zms_journal_hdr hdr;
+	size_t off = 0;
+	int rc;
+
+	for (size_t i = 0; i < count; i++) {
+		size_t val_len = entries[i].value ? entries[i].val_len : 0;
+
+		if (settings_zms_value_unchanged(cf, entries[i].name, entries[i].value,
+						 val_len)) {
+			continue;
+		}
+
+		hdr.name_len = strnlen(entries[i].name, SETTINGS_FULL_NAME_LEN);
+		hdr.val_len = val_len;
+
+		if ((val_len > UINT16_MAX) ||
+		    (off + sizeof(hdr) + hdr.name_len + val_len > sizeof(settings_zms_journal))) {
+			return -ENOMEM;
+		}
+
+		memcpy(&settings_zms_journal[off], &hdr, sizeof(hdr));
+		off += sizeof(hdr);
+		memcpy(&settings_zms_journal[off], entries[i].name, hdr.name_len);
+		off += hdr.name_len;
+		if (val_len) {
+			memcpy(&settings_zms_journal[off], entries[i].value, val_len);
+			off += val_len;
+		}
+	}
+
+	if (off == 0) {
+		/* Nothing changed */
+		return 0;
+	}
+
+	/* Commit */
+	rc = zms_write(&cf->cf_zms, ZMS_BATCH_JOURNAL_ID, settings_zms_journal, off);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return settings_zms_journal_apply(cf, off);
+}
+
+static int settings_zms_batch_recover(struct settings_zms *cf)
+{
+	ssize_t rc;
+
+	rc = zms_read(&cf->cf_zms, ZMS_BATCH_JOURNAL_ID, settings_zms_journal,
+		      sizeof(settings_zms_journal));
+	if (rc == -ENOENT) {
+		return 0;
+	} else if (rc < 0) {
+		return rc;
+	}
+
+	LOG_INF("Replaying interrupted settings batch");
+
+	return settings_zms_journal_apply(cf, MIN(rc, sizeof(settings_zms_journal)));
+}
+#endif /* CONFIG_SETTINGS_SAVE_BATCH */
+
 /* This function inits the linked list head if it doesn't exist or recover it
  * if the ll_last_hash_id is different than the head hash ID
  */
@@ -691,6 +843,12 @@ static int settings_zms_backend_init(struct settings_zms *cf)
 
 	rc = settings_zms_get_last_hash_ids(cf);
 
+#ifdef CONFIG_SETTINGS_SAVE_BATCH
+	if (rc == 0) {
+		rc = settings_zms_batch_recover(cf);
+	}
+#endif
+
 	LOG_DBG("ZMS backend initialized");
 	return rc;
 }
@@ -102,6 +102,10 @@ static int cmd_device_list(const struct shell *sh,
 		}
 #endif /* CONFIG_DEVICE_DEPS */
 
+#ifdef CONFIG_DEVICE_INIT_TIME
+		shell_fprintf(sh, SHELL_NORMAL, "  init time: %u us\n", device_init_time_get(dev));
+#endif /* CONFIG_DEVICE_INIT_TIME */
+
 #ifdef CONFIG_DEVICE_DT_METADATA
 		const struct device_dt_nodelabels *nl = device_get_dt_nodelabels(dev);
 
@@ -7,6 +7,7 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/shell/shell.h>
 #if defined(CONFIG_SHELL_BACKEND_DUMMY)
 #include <zephyr/shell/shell_dummy.h>
@@ -640,7 +641,7 @@ static int execute(const struct shell *sh)
 	bool has_last_handler = false;
 
 	z_shell_op_cursor_end_move(sh);
-	if (!z_shell_cursor_in_empty_line(sh)) {
+	if (!z_shell_cursor_in_empty_line(sh) && !z_flag_machine_get(sh)) {
 		z_cursor_next_line_move(sh);
 	}
 
@@ -983,6 +984,22 @@ static inline int ascii_filter(const char data)
 	}
 }
 
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+/* Sends the output of the command, followed by its return value so that the
+ * client knows that it is done.
+ */
+static void machine_cmd_done(const struct shell *sh, int ret_val)
+{
+	uint8_t buf[sizeof(int32_t)];
+
+	z_transport_buffer_flush(sh);
+
+	sys_put_le32((uint32_t)ret_val, buf);
+	z_shell_machine_frame_write(sh, SHELL_MACHINE_FRAME_RET, buf, sizeof(buf));
+	sh->ctx->machine_frame = SHELL_MACHINE_FRAME_OUT;
+}
+#endif
+
 static void state_collect(const struct shell *sh)
 {
 	size_t count = 0;
@@ -1036,13 +1053,26 @@ static void state_collect(const struct shell *sh)
 		switch (sh->ctx->receive_state) {
 		case SHELL_RECEIVE_DEFAULT:
 			if (process_nl(sh, data)) {
+				int ret_val = 0;
+
 				if (!sh->ctx->cmd_buff_len) {
 					history_mode_exit(sh);
-					z_cursor_next_line_move(sh);
+					if (!z_flag_machine_get(sh)) {
+						z_cursor_next_line_move(sh);
+					}
 				} else {
 					/* Command execution */
-					sh->ctx->ret_val = execute(sh);
+					ret_val = execute(sh);
+					sh->ctx->ret_val = ret_val;
+				}
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+				/* Also on empty lines, so that clients can
+				 * synchronize with the shell.
+				 */
+				if (z_flag_machine_get(sh)) {
+					machine_cmd_done(sh, ret_val);
 				}
+#endif
 				/* Function responsible for printing prompt
 				 * on received NL.
 				 */
@@ -1798,6 +1828,46 @@ int shell_echo_set(const struct shell *sh, bool val)
 	return (int)z_flag_echo_set(sh, val);
 }
 
+int shell_machine_mode_set(const struct shell *sh, bool val)
+{
+	if (sh == NULL) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+	sh->ctx->machine_frame = SHELL_MACHINE_FRAME_OUT;
+
+	return (int)z_flag_machine_set(sh, val);
+#else
+	ARG_UNUSED(val);
+
+	return -ENOTSUP;
+#endif
+}
+
+int shell_machine_write(const struct shell *sh, const void *data, size_t len)
+{
+	__ASSERT_NO_MSG(sh);
+	__ASSERT(!k_is_in_isr(), "Thread context required.");
+	__ASSERT_NO_MSG(z_flag_cmd_ctx_get(sh) ||
+			(k_current_get() != sh->ctx->tid));
+
+	if (!z_flag_machine_get(sh)) {
+		return -ENOTSUP;
+	}
+
+	if (!z_shell_trylock(sh, SHELL_TX_MTX_TIMEOUT)) {
+		return -EBUSY;
+	}
+
+	z_transport_buffer_flush(sh);
+	z_shell_machine_frame_write(sh, SHELL_MACHINE_FRAME_BIN, data, len);
+
+	z_shell_unlock(sh);
+
+	return 0;
+}
+
 int shell_obscure_set(const struct shell *sh, bool val)
 {
 	if (sh == NULL) {
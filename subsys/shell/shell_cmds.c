@@ -47,6 +47,10 @@
 	"Assume 80 chars screen width and send this setting "	\
 	"to the terminal."
 #define SHELL_HELP_HISTORY	"Command history."
+#define SHELL_HELP_MACHINE	"Toggle machine mode."
+#define SHELL_HELP_MACHINE_ON	\
+	"Enable machine mode: no echo, prompt or VT100 commands, framed output."
+#define SHELL_HELP_MACHINE_OFF	"Disable machine mode."
 #define SHELL_HELP_ECHO		"Toggle shell echo."
 #define SHELL_HELP_ECHO_ON	"Enable shell echo."
 #define SHELL_HELP_ECHO_OFF	\
@@ -350,6 +354,28 @@ static int cmd_echo(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_machine_off(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	z_transport_buffer_flush(sh);
+	(void)shell_machine_mode_set(sh, false);
+
+	return 0;
+}
+
+static int cmd_machine_on(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	z_transport_buffer_flush(sh);
+	(void)shell_machine_mode_set(sh, true);
+
+	return 0;
+}
+
 static int cmd_history(const struct shell *sh, size_t argc, char **argv)
 {
 	ARG_UNUSED(argc);
@@ -500,6 +526,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_echo,
 	SHELL_SUBCMD_SET_END
 );
 
+SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_machine,
+	SHELL_COND_CMD_ARG(CONFIG_SHELL_MACHINE_MODE, off, NULL,
+			   SHELL_HELP_MACHINE_OFF, cmd_machine_off, 1, 0),
+	SHELL_COND_CMD_ARG(CONFIG_SHELL_MACHINE_MODE, on, NULL,
+			   SHELL_HELP_MACHINE_ON, cmd_machine_on, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_shell_stats,
 	SHELL_CMD_ARG(reset, NULL, SHELL_HELP_STATISTICS_RESET,
 			cmd_shell_stats_reset, 1, 0),
@@ -526,6 +560,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_shell,
 		       SHELL_HELP_VT100, NULL),
 	SHELL_CMD(prompt, &m_sub_prompt, SHELL_HELP_PROMPT, NULL),
 	SHELL_CMD_ARG(echo, &m_sub_echo, SHELL_HELP_ECHO, cmd_echo, 1, 1),
+	SHELL_COND_CMD(CONFIG_SHELL_MACHINE_MODE, machine, &m_sub_machine,
+		       SHELL_HELP_MACHINE, NULL),
 	SHELL_COND_CMD(CONFIG_SHELL_STATS, stats, &m_sub_shell_stats,
 			SHELL_HELP_STATISTICS, NULL),
 	SHELL_SUBCMD_SET_END
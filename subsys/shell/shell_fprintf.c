@@ -16,7 +16,8 @@ static int out_func(int c, void *ctx)
 	sh_fprintf = (const struct shell_fprintf *)ctx;
 	sh = (const struct shell *)sh_fprintf->user_ctx;
 
-	if ((sh->shell_flag == SHELL_FLAG_OLF_CRLF) && (c == '\n')) {
+	if ((sh->shell_flag == SHELL_FLAG_OLF_CRLF) && (c == '\n') &&
+	    !(IS_ENABLED(CONFIG_SHELL_MACHINE_MODE) && sh->ctx->cfg.flags.machine)) {
 		(void)out_func('\r', ctx);
 	}
 
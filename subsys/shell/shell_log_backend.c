@@ -13,7 +13,14 @@ static bool process_msg_from_buffer(const struct shell *sh);
 
 int z_shell_log_backend_output_func(uint8_t *data, size_t length, void *ctx)
 {
-	z_shell_print_stream(ctx, data, length);
+	const struct shell *sh = ctx;
+
+	if (z_flag_machine_get(sh)) {
+		z_shell_machine_frame_write(sh, SHELL_MACHINE_FRAME_LOG, data, length);
+	} else {
+		z_shell_print_stream(ctx, data, length);
+	}
+
 	return length;
 }
 
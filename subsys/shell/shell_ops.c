@@ -5,6 +5,7 @@
  */
 
 #include <ctype.h>
+#include <zephyr/sys/byteorder.h>
 #include "shell_ops.h"
 
 #define CMD_CURSOR_LEN 8
@@ -420,6 +421,10 @@ void z_shell_print_cmd(const struct shell *sh)
 
 void z_shell_print_prompt_and_cmd(const struct shell *sh)
 {
+	if (z_flag_machine_get(sh)) {
+		return;
+	}
+
 	print_prompt(sh);
 
 	if (z_flag_echo_get(sh)) {
@@ -442,11 +447,9 @@ static void shell_pend_on_txdone(const struct shell *sh)
 	}
 }
 
-void z_shell_write(const struct shell *sh, const void *data,
-		 size_t length)
+static void transport_write(const struct shell *sh, const void *data,
+			    size_t length)
 {
-	__ASSERT_NO_MSG(sh && data);
-
 	size_t offset = 0;
 	size_t tmp_cnt;
 
@@ -466,6 +469,44 @@ void z_shell_write(const struct shell *sh, const void *data,
 	}
 }
 
+void z_shell_machine_frame_write(const struct shell *sh,
+				 enum shell_machine_frame type,
+				 const void *data, size_t length)
+{
+	const uint8_t *buf = data;
+	uint8_t hdr[SHELL_MACHINE_FRAME_HDR_SIZE];
+
+	hdr[0] = SHELL_MACHINE_FRAME_START;
+	hdr[1] = (uint8_t)type;
+
+	while (length) {
+		uint16_t chunk = (uint16_t)MIN(length, UINT16_MAX);
+
+		sys_put_le16(chunk, &hdr[2]);
+		transport_write(sh, hdr, sizeof(hdr));
+		transport_write(sh, buf, chunk);
+
+		buf += chunk;
+		length -= chunk;
+	}
+}
+
+void z_shell_write(const struct shell *sh, const void *data,
+		 size_t length)
+{
+	__ASSERT_NO_MSG(sh && data);
+
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+	if (z_flag_machine_get(sh)) {
+		z_shell_machine_frame_write(sh, sh->ctx->machine_frame, data,
+					    length);
+		return;
+	}
+#endif
+
+	transport_write(sh, data, length);
+}
+
 /* Function shall be only used by the fprintf module. */
 void z_shell_print_stream(const void *user_ctx, const char *data, size_t len)
 {
@@ -530,6 +571,22 @@ void z_shell_vt100_colors_restore(const struct shell *sh,
 void z_shell_vfprintf(const struct shell *sh, enum shell_vt100_color color,
 		      const char *fmt, va_list args)
 {
+#if defined(CONFIG_SHELL_MACHINE_MODE)
+	if (z_flag_machine_get(sh)) {
+		uint8_t type = ((color == SHELL_ERROR) || (color == SHELL_WARNING)) ?
+			       SHELL_MACHINE_FRAME_ERR : SHELL_MACHINE_FRAME_OUT;
+
+		/* Text buffered so far belongs to the previous frame type. */
+		if (type != sh->ctx->machine_frame) {
+			z_shell_fprintf_buffer_flush(sh->fprintf_ctx);
+			sh->ctx->machine_frame = type;
+		}
+
+		z_shell_fprintf_fmt(sh->fprintf_ctx, fmt, args);
+		return;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_SHELL_VT100_COLORS) &&
 	    z_flag_use_colors_get(sh)	  &&
 	    (color != sh->ctx->vt100_ctx.col.col)) {
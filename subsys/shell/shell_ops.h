@@ -50,6 +50,20 @@ static inline void z_shell_raw_fprintf(const struct shell_fprintf *const ctx,
 		_ret_ = (_internal_.flags._flag_ != 0);				\
 	} while (false)
 
+static inline bool z_flag_machine_get(const struct shell *sh)
+{
+	return IS_ENABLED(CONFIG_SHELL_MACHINE_MODE) &&
+	       (sh->ctx->cfg.flags.machine == 1);
+}
+
+static inline bool z_flag_machine_set(const struct shell *sh, bool val)
+{
+	bool ret;
+
+	Z_SHELL_SET_FLAG_ATOMIC(sh, cfg, machine, val, ret);
+	return ret;
+}
+
 static inline bool z_flag_insert_mode_get(const struct shell *sh)
 {
 	return sh->ctx->cfg.flags.insert_mode == 1;
@@ -65,7 +79,7 @@ static inline bool z_flag_insert_mode_set(const struct shell *sh, bool val)
 
 static inline bool z_flag_use_colors_get(const struct shell *sh)
 {
-	return sh->ctx->cfg.flags.use_colors == 1;
+	return (sh->ctx->cfg.flags.use_colors == 1) && !z_flag_machine_get(sh);
 }
 
 static inline bool z_flag_use_colors_set(const struct shell *sh, bool val)
@@ -78,7 +92,7 @@ static inline bool z_flag_use_colors_set(const struct shell *sh, bool val)
 
 static inline bool z_flag_use_vt100_get(const struct shell *sh)
 {
-	return sh->ctx->cfg.flags.use_vt100 == 1;
+	return (sh->ctx->cfg.flags.use_vt100 == 1) && !z_flag_machine_get(sh);
 }
 
 static inline bool z_flag_use_vt100_set(const struct shell *sh, bool val)
@@ -91,7 +105,7 @@ static inline bool z_flag_use_vt100_set(const struct shell *sh, bool val)
 
 static inline bool z_flag_echo_get(const struct shell *sh)
 {
-	return sh->ctx->cfg.flags.echo == 1;
+	return (sh->ctx->cfg.flags.echo == 1) && !z_flag_machine_get(sh);
 }
 
 static inline bool z_flag_echo_set(const struct shell *sh, bool val)
@@ -340,6 +354,14 @@ void z_shell_print_prompt_and_cmd(const struct shell *sh);
  */
 void z_shell_write(const struct shell *sh, const void *data, size_t length);
 
+/* Function sends data in machine mode frames of the given type, regardless of
+ * the type set for the shell output functions. Same restrictions as for
+ * z_shell_write apply.
+ */
+void z_shell_machine_frame_write(const struct shell *sh,
+				 enum shell_machine_frame type,
+				 const void *data, size_t length);
+
 /**
  * @internal @brief This function shall not be used directly, it is required by
  *		    the fprintf module.
@@ -16,6 +16,10 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+#include <zephyr/init.h>
+#endif
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 #include <zephyr/settings/settings.h>
 
@@ -39,6 +43,9 @@ static int settings_direct_loader(const char *key, size_t len,
 		/* Check that loaded progress is not outdated. */
 		if (bytes_written >= ctx->bytes_written) {
 			ctx->bytes_written = bytes_written;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+			ctx->bytes_queued = bytes_written;
+#endif
 		} else {
 			LOG_WRN("Loaded outdated bytes_written %zu < %zu",
 				bytes_written, ctx->bytes_written);
@@ -184,7 +191,7 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf, size_t buf_bytes)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -193,32 +200,32 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	uint8_t filler;
 
 
-	if (ctx->buf_bytes == 0) {
+	if (buf_bytes == 0) {
 		return 0;
 	}
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
-		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
+		rc = stream_flash_erase_to_append(ctx, buf_bytes);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_forward_erase %d range=0x%08zx",
-				rc, ctx->buf_bytes);
+				rc, buf_bytes);
 			return rc;
 		}
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -232,18 +239,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
@@ -252,12 +258,190 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 
 #endif
 
-	ctx->bytes_written += ctx->buf_bytes;
-	ctx->buf_bytes = 0U;
+	ctx->bytes_written += buf_bytes;
+
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes);
+
+	if (rc == 0) {
+		ctx->buf_bytes = 0U;
+	}
 
 	return rc;
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+static K_THREAD_STACK_DEFINE(stream_flash_workq_stack, CONFIG_STREAM_FLASH_WORKQUEUE_STACK_SIZE);
+static struct k_work_q stream_flash_workq;
+
+static void stream_flash_write_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, work);
+	int rc;
+
+	rc = flash_sync_buf(ctx, ctx->wr_buf, ctx->wr_bytes);
+
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) && rc == 0 &&
+	    ctx->bytes_written < ctx->available) {
+		/* Erase ahead what the buffer being filled will need, so that
+		 * its write does not have to wait for the erase.
+		 */
+		rc = stream_flash_erase_to_append(ctx, MIN(ctx->buf_len,
+				ctx->available - ctx->bytes_written));
+	}
+
+	ctx->wr_rc = rc;
+	k_sem_give(&ctx->wr_idle);
+}
+
+/* Wait for the background write, if any, and return its result */
+static int stream_flash_wait_idle(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	(void)k_sem_take(&ctx->wr_idle, K_FOREVER);
+	rc = ctx->wr_rc;
+	k_sem_give(&ctx->wr_idle);
+
+	return rc;
+}
+
+/* Hand the filled buffer over to the work queue and switch to the other one */
+static int stream_flash_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *filled = ctx->buf;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	(void)k_sem_take(&ctx->wr_idle, K_FOREVER);
+
+	rc = ctx->wr_rc;
+	if (rc != 0) {
+		ctx->wr_rc = 0;
+		k_sem_give(&ctx->wr_idle);
+		return rc;
+	}
+
+	ctx->wr_buf = filled;
+	ctx->wr_bytes = ctx->buf_bytes;
+	ctx->bytes_queued += ctx->buf_bytes;
+	ctx->buf = ctx->buf_alt;
+	ctx->buf_alt = filled;
+	ctx->buf_bytes = 0U;
+
+	(void)k_work_submit_to_queue(&stream_flash_workq, &ctx->work);
+
+	return 0;
+}
+
+/* The work item and semaphore are set up once, by the first enable call */
+static inline bool stream_flash_work_initialized(const struct stream_flash_ctx *ctx)
+{
+	return ctx->work.handler == stream_flash_write_work;
+}
+
+/* Cancel or wait for the background write, if any, before the context is
+ * re-initialized.
+ */
+static void stream_flash_drain(struct stream_flash_ctx *ctx)
+{
+	struct k_work_sync sync;
+
+	if (!stream_flash_work_initialized(ctx)) {
+		return;
+	}
+
+	(void)k_work_cancel_sync(&ctx->work, &sync);
+
+	/* A write cancelled before it ran leaves wr_idle taken */
+	if (k_sem_count_get(&ctx->wr_idle) == 0U) {
+		k_sem_give(&ctx->wr_idle);
+	}
+
+	(void)k_sem_take(&ctx->wr_idle, K_FOREVER);
+	k_sem_give(&ctx->wr_idle);
+}
+
+int stream_flash_double_buffer_enable(struct stream_flash_ctx *ctx, uint8_t *buf2)
+{
+	if (!ctx || !buf2 || buf2 == ctx->buf) {
+		return -EFAULT;
+	}
+
+	if (!stream_flash_work_initialized(ctx)) {
+		k_work_init(&ctx->work, stream_flash_write_work);
+		k_sem_init(&ctx->wr_idle, 1, 1);
+	}
+
+	(void)k_sem_take(&ctx->wr_idle, K_FOREVER);
+	ctx->buf_alt = buf2;
+	ctx->wr_buf = NULL;
+	ctx->wr_bytes = 0;
+	ctx->wr_rc = 0;
+	ctx->bytes_queued = ctx->bytes_written;
+	k_sem_give(&ctx->wr_idle);
+
+	return 0;
+}
+
+static int stream_flash_workq_init(void)
+{
+	k_work_queue_start(&stream_flash_workq, stream_flash_workq_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_workq_stack),
+			   CONFIG_STREAM_FLASH_WORKQUEUE_PRIORITY, NULL);
+	k_thread_name_set(&stream_flash_workq.thread, "stream_flash");
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static inline bool stream_flash_double_buffered(const struct stream_flash_ctx *ctx)
+{
+	return ctx->buf_alt != NULL;
+}
+
+static inline size_t stream_flash_bytes_committed(const struct stream_flash_ctx *ctx)
+{
+	return stream_flash_double_buffered(ctx) ? ctx->bytes_queued : ctx->bytes_written;
+}
+#else
+static inline bool stream_flash_double_buffered(const struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return false;
+}
+
+static inline size_t stream_flash_bytes_committed(const struct stream_flash_ctx *ctx)
+{
+	return ctx->bytes_written;
+}
+
+static inline int stream_flash_submit(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return -ENOTSUP;
+}
+
+static inline int stream_flash_wait_idle(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return 0;
+}
+
+static inline void stream_flash_drain(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -269,7 +453,13 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (stream_flash_bytes_committed(ctx) + ctx->buf_bytes + len > ctx->available) {
+		if (stream_flash_double_buffered(ctx)) {
+			/* Callers may drop the context on error, so do not
+			 * leave a background write behind.
+			 */
+			(void)stream_flash_wait_idle(ctx);
+		}
 		return -ENOMEM;
 	}
 
@@ -279,7 +469,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+		if (stream_flash_double_buffered(ctx)) {
+			rc = stream_flash_submit(ctx);
+		} else {
+			rc = flash_sync(ctx);
+		}
 
 		if (rc != 0) {
 			return rc;
@@ -295,7 +489,14 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
-	if (flush && ctx->buf_bytes > 0) {
+	if (stream_flash_double_buffered(ctx)) {
+		if (flush) {
+			rc = stream_flash_submit(ctx);
+			if (rc == 0) {
+				rc = stream_flash_wait_idle(ctx);
+			}
+		}
+	} else if (flush && ctx->buf_bytes > 0) {
 		rc = flash_sync(ctx);
 	}
 
@@ -392,6 +593,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		return -EFAULT;
 	}
 
+	/* The context may be re-initialized while a write is still queued */
+	stream_flash_drain(ctx);
+
 	ctx->fdev = fdev;
 	ctx->buf = buf;
 	ctx->buf_len = buf_len;
@@ -412,6 +616,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->erased_up_to = 0;
 #endif
 	ctx->erase_value = params->erase_value;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	ctx->buf_alt = NULL;
+#endif
 
 	/* Inspection is deliberately done once context has been filled in */
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_INSPECT)) {
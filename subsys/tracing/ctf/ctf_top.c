@@ -8,6 +8,7 @@
 #include <zephyr/kernel_structs.h>
 #include <kernel_internal.h>
 #include <ctf_top.h>
+#include <tracing_core.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/socket_poll.h>
@@ -1617,3 +1618,28 @@ void sys_trace_k_event_wait_exit(struct k_event *event, uint32_t events, int ret
 {
 	ctf_top_event_wait_exit((uint32_t)(uintptr_t)event, events, (int32_t)ret);
 }
+
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+void tracing_buffer_cpu_handle(uint8_t cpu, uint8_t *data, uint32_t length)
+{
+	uint8_t epacket[sizeof(uint32_t) + sizeof(uint16_t) + sizeof(cpu)];
+	uint8_t *epacket_cursor = &epacket[0];
+	const uint16_t id = CTF_EVENT_CPU_ID;
+
+#ifdef CONFIG_TRACING_CTF_TIMESTAMP
+	uint32_t tstamp = 0;
+
+	/* Reuse the timestamp of the first event of the CPU buffer, so the
+	 * marker does not move time forward in the stream.
+	 */
+	if (length >= sizeof(tstamp)) {
+		memcpy(&tstamp, data, sizeof(tstamp));
+	}
+	CTF_INTERNAL_FIELD_APPEND(tstamp);
+#endif
+	CTF_INTERNAL_FIELD_APPEND(id);
+	CTF_INTERNAL_FIELD_APPEND(cpu);
+
+	tracing_buffer_handle(epacket, epacket_cursor - epacket);
+}
+#endif
@@ -49,7 +49,17 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));                                 \
 	}
 
-#ifdef CONFIG_TRACING_CTF_TIMESTAMP
+#if defined(CONFIG_TRACING_CTF_TIMESTAMP) && defined(CONFIG_TRACING_BUFFER_PER_CPU)
+/* Timestamps only have to be ordered within the buffer of a CPU */
+#define CTF_EVENT(...)                                                                             \
+	{                                                                                          \
+		unsigned int key = arch_irq_lock();                                                \
+		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32());                     \
+                                                                                                   \
+		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                                             \
+		arch_irq_unlock(key);                                                              \
+	}
+#elif defined(CONFIG_TRACING_CTF_TIMESTAMP)
 #define CTF_EVENT(...)                                                                             \
 	{                                                                                          \
 		int key = irq_lock();                                                              \
@@ -341,6 +351,9 @@ typedef enum {
 	CTF_EVENT_TIMER_STOP_FN_EXPIRY_ENTER = 0x102,
 	CTF_EVENT_TIMER_STOP_FN_EXPIRY_EXIT = 0x103,
 
+	/* Following events come from another CPU buffer */
+	CTF_EVENT_CPU_ID = 0x104,
+
 } ctf_event_t;
 
 typedef struct {
@@ -104,6 +104,19 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/**
+ * @brief Select the CPU buffer the next get operations read from.
+ *
+ * The same buffer stays selected until the data it held when it was selected
+ * has been read, so that buffers are only switched on a packet boundary.
+ *
+ * @return Index of the CPU whose buffer is selected, or -ENODATA if all
+ *         buffers are empty.
+ */
+int tracing_buffer_select(void);
+#endif
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -14,9 +14,16 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Buffers are per CPU, only the local CPU has to be locked */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
@@ -33,6 +40,20 @@ bool is_tracing_enabled(void);
  */
 void tracing_buffer_handle(uint8_t *data, uint32_t length);
 
+/**
+ * @brief Handle a switch to the buffer of another CPU.
+ *
+ * Called by the tracing thread before giving the backend the first data
+ * of @p cpu after data of another CPU. The default implementation does
+ * nothing; a tracing format can override it to mark the switch in the
+ * output stream.
+ *
+ * @param cpu Index of the CPU the following data comes from.
+ * @param data Address of the first data of @p cpu.
+ * @param length Length of the data at @p data.
+ */
+void tracing_buffer_cpu_handle(uint8_t cpu, uint8_t *data, uint32_t length);
+
 /**
  * @brief Handle tracing packet drop.
  */
@@ -6,8 +6,12 @@
 
 #include <zephyr/sys/ring_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#endif
+
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -17,6 +21,148 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 	return sizeof(tracing_cmd_buffer);
 }
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/*
+ * Each CPU puts its packets into its own ring buffer, with only local
+ * interrupts masked, so CPUs never contend with each other. The tracing
+ * thread is the only consumer: it drains a snapshot of one buffer at a time,
+ * so that it always switches buffers on a packet boundary.
+ */
+static struct ring_buf tracing_ring_buf[CONFIG_MP_MAX_NUM_CPUS];
+static uint8_t tracing_buffer[CONFIG_MP_MAX_NUM_CPUS][CONFIG_TRACING_BUFFER_SIZE + 1];
+static unsigned int tracing_get_cpu;
+static uint32_t tracing_get_left;
+
+static inline struct ring_buf *tracing_put_buf(void)
+{
+	return &tracing_ring_buf[_current_cpu->id];
+}
+
+uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
+{
+	return ring_buf_put_claim(tracing_put_buf(), data, size);
+}
+
+int tracing_buffer_put_finish(uint32_t size)
+{
+	/* Make the packet visible before the consumer sees the new head */
+	barrier_dmem_fence_full();
+
+	return ring_buf_put_finish(tracing_put_buf(), size);
+}
+
+uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
+{
+	uint32_t total = 0U;
+	uint32_t claimed;
+	uint8_t *dst;
+
+	do {
+		claimed = ring_buf_put_claim(tracing_put_buf(), &dst, size - total);
+		memcpy(dst, data + total, claimed);
+		total += claimed;
+	} while (total < size && claimed != 0U);
+
+	(void)tracing_buffer_put_finish(total);
+
+	return total;
+}
+
+int tracing_buffer_select(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	if (tracing_get_left != 0U) {
+		return tracing_get_cpu;
+	}
+
+	for (unsigned int i = 1; i <= num_cpus; i++) {
+		unsigned int cpu = (tracing_get_cpu + i) % num_cpus;
+
+		tracing_get_left = ring_buf_size_get(&tracing_ring_buf[cpu]);
+		if (tracing_get_left != 0U) {
+			tracing_get_cpu = cpu;
+			barrier_dmem_fence_full();
+			return cpu;
+		}
+	}
+
+	return -ENODATA;
+}
+
+uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
+{
+	if (tracing_buffer_select() < 0) {
+		return 0;
+	}
+
+	return ring_buf_get_claim(&tracing_ring_buf[tracing_get_cpu], data,
+				  MIN(size, tracing_get_left));
+}
+
+int tracing_buffer_get_finish(uint32_t size)
+{
+	int ret;
+
+	ret = ring_buf_get_finish(&tracing_ring_buf[tracing_get_cpu], size);
+	if (ret == 0) {
+		tracing_get_left -= MIN(size, tracing_get_left);
+	}
+
+	return ret;
+}
+
+uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
+{
+	uint32_t length;
+
+	if (tracing_buffer_select() < 0) {
+		return 0;
+	}
+
+	length = ring_buf_get(&tracing_ring_buf[tracing_get_cpu], data,
+			      MIN(size, tracing_get_left));
+	tracing_get_left -= length;
+
+	return length;
+}
+
+void tracing_buffer_init(void)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE(tracing_ring_buf); i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	if (tracing_get_left != 0U) {
+		return false;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
+}
+
+uint32_t tracing_buffer_space_get(void)
+{
+	return ring_buf_space_get(tracing_put_buf());
+}
+#else
+static struct ring_buf tracing_ring_buf;
+static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
 	return ring_buf_put_claim(&tracing_ring_buf, data, size);
@@ -67,3 +213,4 @@ uint32_t tracing_buffer_space_get(void)
 {
 	return ring_buf_space_get(&tracing_ring_buf);
 }
+#endif /* CONFIG_TRACING_BUFFER_PER_CPU */
@@ -44,6 +44,9 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
 	uint32_t transferring_length, tracing_buffer_max_length;
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	int last_cpu = -1;
+#endif
 
 	tracing_thread_tid = k_current_get();
 
@@ -53,10 +56,21 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		if (tracing_buffer_is_empty()) {
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
 		} else {
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+			int cpu = tracing_buffer_select();
+#endif
+
 			transferring_length =
 				tracing_buffer_get_claim(
 						&transferring_buf,
 						tracing_buffer_max_length);
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+			if (cpu != last_cpu && transferring_length != 0U) {
+				tracing_buffer_cpu_handle(cpu, transferring_buf,
+							  transferring_length);
+				last_cpu = cpu;
+			}
+#endif
 			tracing_buffer_handle(transferring_buf,
 					      transferring_length);
 			tracing_buffer_get_finish(transferring_length);
@@ -142,6 +156,15 @@ void tracing_buffer_handle(uint8_t *data, uint32_t length)
 	tracing_backend_output(working_backend, data, length);
 }
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+__weak void tracing_buffer_cpu_handle(uint8_t cpu, uint8_t *data, uint32_t length)
+{
+	ARG_UNUSED(cpu);
+	ARG_UNUSED(data);
+	ARG_UNUSED(length);
+}
+#endif
+
 void tracing_packet_drop_handle(void)
 {
 	atomic_inc(&tracing_packet_drop_num);
@@ -53,6 +53,61 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_CHANNEL_ID)
+/* Set once the channels are sorted by ID */
+static bool _zbus_chan_id_order_ready;
+
+static inline const struct zbus_channel *_zbus_chan_at(int idx)
+{
+	const struct zbus_channel *chan;
+
+	STRUCT_SECTION_GET(zbus_channel, idx, &chan);
+
+	return chan;
+}
+
+static inline const struct zbus_channel *_zbus_chan_by_id_order(int rank)
+{
+	return _zbus_chan_at(_zbus_chan_at(rank)->data->id_order);
+}
+
+static void _zbus_chan_id_order_init(void)
+{
+	int count;
+
+	STRUCT_SECTION_COUNT(zbus_channel, &count);
+
+	/* Insertion sort, stable so that duplicate IDs keep the allocation order */
+	for (int i = 0; i < count; i++) {
+		uint32_t id = _zbus_chan_at(i)->id;
+		int j;
+
+		for (j = i; (j > 0) && (_zbus_chan_by_id_order(j - 1)->id > id); j--) {
+			_zbus_chan_at(j)->data->id_order = _zbus_chan_at(j - 1)->data->id_order;
+		}
+		_zbus_chan_at(j)->data->id_order = i;
+	}
+
+	/* Check for duplicate channel IDs, which are now next to each other */
+	for (int i = 1; i < count; i++) {
+		const struct zbus_channel *chan_prev = _zbus_chan_by_id_order(i - 1);
+		const struct zbus_channel *chan = _zbus_chan_by_id_order(i);
+
+		if ((chan->id == ZBUS_CHAN_ID_INVALID) || (chan->id != chan_prev->id)) {
+			continue;
+		}
+#if defined(CONFIG_ZBUS_CHANNEL_NAME)
+		LOG_WRN("Channels %s and %s have matching IDs (%d)", chan->name, chan_prev->name,
+			chan->id);
+#else
+		LOG_WRN("Channels %p and %p have matching IDs (%d)", chan, chan_prev, chan->id);
+#endif /* CONFIG_ZBUS_CHANNEL_NAME */
+	}
+
+	_zbus_chan_id_order_ready = true;
+}
+#endif /* CONFIG_ZBUS_CHANNEL_ID */
+
 int _zbus_init(void)
 {
 
@@ -77,27 +132,7 @@ int _zbus_init(void)
 	}
 
 #if defined(CONFIG_ZBUS_CHANNEL_ID)
-	STRUCT_SECTION_FOREACH(zbus_channel, chan) {
-		/* Check for duplicate channel IDs */
-		if (chan->id == ZBUS_CHAN_ID_INVALID) {
-			continue;
-		}
-		/* Iterate over all previous channels */
-		STRUCT_SECTION_FOREACH(zbus_channel, chan_prev) {
-			if (chan_prev == chan) {
-				break;
-			}
-			if (chan->id == chan_prev->id) {
-#if defined(CONFIG_ZBUS_CHANNEL_NAME)
-				LOG_WRN("Channels %s and %s have matching IDs (%d)", chan->name,
-					chan_prev->name, chan->id);
-#else
-				LOG_WRN("Channels %p and %p have matching IDs (%d)", chan,
-					chan_prev, chan->id);
-#endif /* CONFIG_ZBUS_CHANNEL_NAME */
-			}
-		}
-	}
+	_zbus_chan_id_order_init();
 #endif /* CONFIG_ZBUS_CHANNEL_ID */
 
 	return 0;
@@ -141,10 +176,41 @@ void async_listener_work_handler(struct k_work *item)
 
 const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id)
 {
+	const struct zbus_channel *chan;
+	int count;
+	int lo = 0;
+	int hi;
+
 	if (channel_id == ZBUS_CHAN_ID_INVALID) {
 		return NULL;
 	}
-	STRUCT_SECTION_FOREACH(zbus_channel, chan) {
+
+	if (!_zbus_chan_id_order_ready) {
+		STRUCT_SECTION_FOREACH(zbus_channel, curr) {
+			if (curr->id == channel_id) {
+				/* Found matching channel */
+				return curr;
+			}
+		}
+		/* No matching channel exists */
+		return NULL;
+	}
+
+	/* Lowest rank with an ID not below channel_id, the first allocated on duplicates */
+	STRUCT_SECTION_COUNT(zbus_channel, &count);
+	hi = count;
+	while (lo < hi) {
+		int mid = lo + ((hi - lo) / 2);
+
+		if (_zbus_chan_by_id_order(mid)->id < channel_id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (lo < count) {
+		chan = _zbus_chan_by_id_order(lo);
 		if (chan->id == channel_id) {
 			/* Found matching channel */
 			return chan;
@@ -158,17 +224,55 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id)
 
 #if defined(CONFIG_ZBUS_CHANNEL_NAME)
 
+/* Compare two channel names in the order the linker allocates the channels. The linker sorts
+ * the channel sections, named "._zbus_channel.static.<name>_", with strcmp(), so the names are
+ * compared as if they were followed by an underscore: "chan1" sorts before "chan".
+ */
+static int _zbus_chan_name_cmp(const char *a, const char *b)
+{
+	while (true) {
+		unsigned char ca = (*a != '\0') ? *a : '_';
+		unsigned char cb = (*b != '\0') ? *b : '_';
+
+		if (ca != cb) {
+			return ca - cb;
+		}
+		if ((*a == '\0') || (*b == '\0')) {
+			/* The trailing underscores match, the name that ends first sorts first */
+			return (*a != '\0') - (*b != '\0');
+		}
+		++a;
+		++b;
+	}
+}
+
 const struct zbus_channel *zbus_chan_from_name(const char *name)
 {
+	int lo = 0;
+	int hi;
+
 	CHECKIF(name == NULL) {
 		return NULL;
 	}
 
-	STRUCT_SECTION_FOREACH(zbus_channel, chan) {
-		if (strcmp(chan->name, name) == 0) {
+	/* The linker sorts the channels by section name, which is made of the channel name */
+	STRUCT_SECTION_COUNT(zbus_channel, &hi);
+	while (lo < hi) {
+		int mid = lo + ((hi - lo) / 2);
+		const struct zbus_channel *chan;
+		int cmp;
+
+		STRUCT_SECTION_GET(zbus_channel, mid, &chan);
+		cmp = _zbus_chan_name_cmp(name, chan->name);
+		if (cmp == 0) {
 			/* Found matching channel */
 			return chan;
 		}
+		if (cmp < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
 	}
 	/* No matching channel exists */
 	return NULL;
@@ -0,0 +1,114 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/printk-hooks.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(cbprintf_perf, LOG_LEVEL_INF);
+
+#define N_ITERATIONS 100
+
+static size_t out_cnt;
+
+static int char_out(int c)
+{
+	out_cnt++;
+
+	return c;
+}
+
+static int log_out(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(ctx);
+
+	out_cnt += length;
+
+	return length;
+}
+
+static uint8_t log_output_buf[64];
+LOG_OUTPUT_DEFINE(log_output_perf, log_out, log_output_buf, sizeof(log_output_buf));
+
+static void process(const struct log_backend *const backend, union log_msg_generic *msg)
+{
+	log_output_msg_process(&log_output_perf, &msg->log, 0);
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api log_backend_perf_api = {
+	.process = process,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(log_backend_perf, log_backend_perf_api, true);
+
+static const char str_arg[] = "sensor0";
+
+#define MEASURE(_name, ...)                                                                        \
+	do {                                                                                       \
+		uint32_t cyc = k_cycle_get_32();                                                   \
+                                                                                                   \
+		for (int i = 0; i < N_ITERATIONS; i++) {                                           \
+			__VA_ARGS__;                                                               \
+		}                                                                                  \
+		cyc = k_cycle_get_32() - cyc;                                                      \
+		results[n_results].name = _name;                                                   \
+		results[n_results].cycles = cyc / N_ITERATIONS;                                    \
+		n_results++;                                                                       \
+	} while (false)
+
+struct result {
+	const char *name;
+	uint32_t cycles;
+};
+
+/**
+ * @brief Measure the cycles spent formatting printk() and LOG_INF() output
+ *
+ * @details The output goes to a printk hook and a log backend which only
+ * count characters, so the result is dominated by cbprintf. Compare builds
+ * with and without CONFIG_CBPRINTF_FORMAT_CACHE.
+ */
+ZTEST(cbprintf_perf, test_cbprintf_perf)
+{
+	struct result results[8];
+	size_t n_results = 0;
+	printk_hook_fn_t hook = __printk_get_hook();
+
+	__printk_hook_install(char_out);
+
+	MEASURE("printk literal", printk("connection established\n"));
+	MEASURE("printk %d", printk("value %d\n", i));
+	MEASURE("printk %s %u 0x%08x",
+		printk("%s: read %u bytes at 0x%08x\n", str_arg, i, 0x20001000 + i));
+	MEASURE("printk %p", printk("ptr %p\n", &results[0]));
+
+	__printk_hook_install(hook);
+
+	MEASURE("LOG_INF literal", LOG_INF("connection established"));
+	MEASURE("LOG_INF %d", LOG_INF("value %d", i));
+	MEASURE("LOG_INF %s %u 0x%08x",
+		LOG_INF("%s: read %u bytes at 0x%08x", str_arg, i, 0x20001000 + i));
+
+	zassert_true(out_cnt > 0);
+
+	TC_PRINT("format cache %s\n", IS_ENABLED(CONFIG_CBPRINTF_FORMAT_CACHE) ? "on" : "off");
+	for (size_t i = 0; i < n_results; i++) {
+		TC_PRINT("%-24s %8u cycles\n", results[i].name, results[i].cycles);
+	}
+}
+
+ZTEST_SUITE(cbprintf_perf, NULL, NULL, NULL, NULL, NULL);
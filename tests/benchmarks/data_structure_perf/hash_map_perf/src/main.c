@@ -0,0 +1,119 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/hash_map.h>
+
+#define N_ENTRIES 1024
+
+/* spread the keys, as sequential keys favor some hash functions */
+#define KEY(i) ((uint64_t)(i) * 0x9E3779B97F4A7C15ULL)
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_SWISS_DEFINE_STATIC(swiss_map);
+
+struct op_stats {
+	uint64_t total;
+	uint64_t max;
+};
+
+static void op_stats_add(struct op_stats *stats, timing_t *start, timing_t *end)
+{
+	uint64_t cycles = timing_cycles_get(start, end);
+
+	stats->total += cycles;
+	stats->max = MAX(stats->max, cycles);
+}
+
+static void op_stats_print(const char *name, const char *op, struct op_stats *stats)
+{
+	TC_PRINT("%-8s %-12s avg %6llu ns, max %8llu ns\n", name, op,
+		 timing_cycles_to_ns(stats->total) / N_ENTRIES, timing_cycles_to_ns(stats->max));
+}
+
+static void hash_map_bench(const char *name, struct sys_hashmap *map)
+{
+	int ret;
+	uint64_t value;
+	timing_t start;
+	timing_t end;
+	struct op_stats insert = {0};
+	struct op_stats get_hit = {0};
+	struct op_stats get_miss = {0};
+	struct op_stats remove = {0};
+
+	timing_start();
+
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		start = timing_counter_get();
+		ret = sys_hashmap_insert(map, KEY(i), i, NULL);
+		end = timing_counter_get();
+		zassert_equal(ret, 1, "failed to insert %zu: %d", i, ret);
+		op_stats_add(&insert, &start, &end);
+	}
+
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		start = timing_counter_get();
+		ret = sys_hashmap_get(map, KEY(i), &value);
+		end = timing_counter_get();
+		zassert_true(ret && value == i, "failed to get %zu", i);
+		op_stats_add(&get_hit, &start, &end);
+	}
+
+	for (size_t i = N_ENTRIES; i < 2 * N_ENTRIES; ++i) {
+		start = timing_counter_get();
+		ret = sys_hashmap_get(map, KEY(i), NULL);
+		end = timing_counter_get();
+		zassert_false(ret, "unexpectedly got %zu", i);
+		op_stats_add(&get_miss, &start, &end);
+	}
+
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		start = timing_counter_get();
+		ret = sys_hashmap_remove(map, KEY(i), NULL);
+		end = timing_counter_get();
+		zassert_true(ret, "failed to remove %zu", i);
+		op_stats_add(&remove, &start, &end);
+	}
+
+	timing_stop();
+
+	zassert_true(sys_hashmap_is_empty(map));
+
+	op_stats_print(name, "insert", &insert);
+	op_stats_print(name, "get (hit)", &get_hit);
+	op_stats_print(name, "get (miss)", &get_miss);
+	op_stats_print(name, "remove", &remove);
+}
+
+/**
+ * @brief Compare the Hashmap implementations
+ *
+ * @details Insert, look up and remove the same keys in each implementation
+ * and report the average and worst-case time of each operation. The worst
+ * case of insertions and removals is dominated by rehashing, unless
+ * CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH is enabled.
+ */
+ZTEST(hash_map_perf, test_hash_map_perf)
+{
+	TC_PRINT("%u entries, incremental rehashing %s\n", N_ENTRIES,
+		 IS_ENABLED(CONFIG_SYS_HASH_MAP_INCREMENTAL_REHASH) ? "on" : "off");
+
+	hash_map_bench("sc", &sc_map);
+	hash_map_bench("oa_lp", &oa_lp_map);
+	hash_map_bench("swiss", &swiss_map);
+}
+
+static void *hash_map_perf_setup(void)
+{
+	timing_init();
+
+	return NULL;
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, hash_map_perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,127 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#define N_ITERATIONS 256
+#define MAX_LEN      4096
+
+static const size_t lengths[] = {8, 64, 256, 1024, MAX_LEN};
+
+static uint8_t buf_a[MAX_LEN + 16] __aligned(16);
+static uint8_t buf_b[MAX_LEN + 16] __aligned(16);
+
+/* called through pointers so that the compiler can't inline the builtins */
+static void *(*volatile memcpy_fn)(void *, const void *, size_t) = memcpy;
+static void *(*volatile memmove_fn)(void *, const void *, size_t) = memmove;
+static void *(*volatile memset_fn)(void *, int, size_t) = memset;
+static int (*volatile memcmp_fn)(const void *, const void *, size_t) = memcmp;
+static void *(*volatile memchr_fn)(const void *, int, size_t) = memchr;
+static size_t (*volatile strlen_fn)(const char *) = strlen;
+
+enum string_op {
+	OP_MEMCPY,
+	OP_MEMMOVE,
+	OP_MEMSET,
+	OP_MEMCMP,
+	OP_MEMCHR,
+	OP_STRLEN,
+};
+
+static const char *const op_names[] = {
+	[OP_MEMCPY] = "memcpy",
+	[OP_MEMMOVE] = "memmove",
+	[OP_MEMSET] = "memset",
+	[OP_MEMCMP] = "memcmp",
+	[OP_MEMCHR] = "memchr",
+	[OP_STRLEN] = "strlen",
+};
+
+static void run_op(enum string_op op, uint8_t *dst, uint8_t *src, size_t len)
+{
+	switch (op) {
+	case OP_MEMCPY:
+		(void)memcpy_fn(dst, src, len);
+		break;
+	case OP_MEMMOVE:
+		(void)memmove_fn(dst, src, len);
+		break;
+	case OP_MEMSET:
+		(void)memset_fn(dst, 0x5a, len);
+		break;
+	case OP_MEMCMP:
+		(void)memcmp_fn(dst, src, len);
+		break;
+	case OP_MEMCHR:
+		(void)memchr_fn(src, 0, len);
+		break;
+	case OP_STRLEN:
+		(void)strlen_fn((const char *)src);
+		break;
+	}
+}
+
+static uint64_t bench_op(enum string_op op, size_t dst_off, size_t src_off, size_t len)
+{
+	uint8_t *dst = &buf_b[dst_off];
+	uint8_t *src = &buf_a[src_off];
+	timing_t start;
+	timing_t end;
+
+	/* equal buffers and a single terminator at the end make memcmp,
+	 * memchr and strlen go through the whole length
+	 */
+	memset(buf_a, 'a', sizeof(buf_a));
+	memset(buf_b, 'a', sizeof(buf_b));
+	src[len - 1] = '\0';
+	dst[len - 1] = '\0';
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		run_op(op, dst, src, len);
+	}
+	end = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &end)) / N_ITERATIONS;
+}
+
+/**
+ * @brief Measure the memory and string functions of the selected C library
+ *
+ * @details Report the average time of a call for several lengths, with
+ * word-aligned buffers and with buffers of different misalignment. Build
+ * the test for each C library to compare them.
+ */
+ZTEST(libc_string_perf, test_string_perf)
+{
+	TC_PRINT("%-8s %6s %12s %12s\n", "op", "len", "aligned", "unaligned");
+
+	timing_start();
+
+	for (int op = 0; op < ARRAY_SIZE(op_names); op++) {
+		for (int i = 0; i < ARRAY_SIZE(lengths); i++) {
+			uint64_t aligned = bench_op(op, 0, 0, lengths[i]);
+			uint64_t unaligned = bench_op(op, 1, 3, lengths[i]);
+
+			TC_PRINT("%-8s %6zu %9llu ns %9llu ns\n", op_names[op], lengths[i],
+				 aligned, unaligned);
+		}
+	}
+
+	timing_stop();
+}
+
+static void *libc_string_perf_setup(void)
+{
+	timing_init();
+
+	return NULL;
+}
+
+ZTEST_SUITE(libc_string_perf, NULL, libc_string_perf_setup, NULL, NULL, NULL);
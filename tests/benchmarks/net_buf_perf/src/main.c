@@ -0,0 +1,107 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/net_buf.h>
+
+#define N_ITERATIONS 256
+#define CHAIN_LEN    8
+#define FRAG_SIZE    128
+#define BLOCK_SIZE   1024
+
+NET_BUF_POOL_FIXED_DEFINE(fixed_pool, CHAIN_LEN, FRAG_SIZE, 0, NULL);
+NET_BUF_POOL_VAR_DEFINE(var_pool, CHAIN_LEN, CHAIN_LEN * 2 * FRAG_SIZE, 0, NULL);
+NET_BUF_POOL_VAR_ARENA_DEFINE(arena_pool, CHAIN_LEN, CHAIN_LEN * 2 * FRAG_SIZE, BLOCK_SIZE, 0,
+			      NULL);
+
+static struct net_buf *chain_alloc_single(struct net_buf_pool *pool)
+{
+	struct net_buf *head = net_buf_alloc_len(pool, FRAG_SIZE, K_NO_WAIT);
+
+	zassert_not_null(head, "Failed to get buffer");
+
+	for (int i = 1; i < CHAIN_LEN; i++) {
+		struct net_buf *frag = net_buf_alloc_len(pool, FRAG_SIZE, K_NO_WAIT);
+
+		zassert_not_null(frag, "Failed to get buffer");
+		net_buf_frag_add(head, frag);
+	}
+
+	return head;
+}
+
+static struct net_buf *chain_alloc_batch(struct net_buf_pool *pool)
+{
+	struct net_buf *bufs[CHAIN_LEN];
+
+	zassert_ok(net_buf_alloc_batch(pool, FRAG_SIZE, bufs, CHAIN_LEN),
+		   "Failed to get buffers");
+
+	for (int i = 1; i < CHAIN_LEN; i++) {
+		net_buf_frag_add(bufs[0], bufs[i]);
+	}
+
+	return bufs[0];
+}
+
+static uint64_t bench_chain(struct net_buf_pool *pool,
+			    struct net_buf *(*alloc)(struct net_buf_pool *pool))
+{
+	timing_t start;
+	timing_t end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		net_buf_unref(alloc(pool));
+	}
+	end = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &end)) / N_ITERATIONS;
+}
+
+/**
+ * @brief Measure the allocation and release of fragment chains
+ *
+ * @details Allocate a chain of CHAIN_LEN fragments one buffer at a time and
+ * with net_buf_alloc_batch(), then release it with a single net_buf_unref(),
+ * from pools with fixed size, heap and arena backed data. Report the
+ * average time of a chain.
+ */
+ZTEST(net_buf_perf, test_chain_perf)
+{
+	static const struct {
+		const char *name;
+		struct net_buf_pool *pool;
+	} pools[] = {
+		{"fixed", &fixed_pool},
+		{"var", &var_pool},
+		{"arena", &arena_pool},
+	};
+
+	TC_PRINT("%u fragments of %u bytes per chain\n", CHAIN_LEN, FRAG_SIZE);
+	TC_PRINT("%-8s %12s %12s\n", "pool", "single", "batch");
+
+	timing_start();
+
+	for (int i = 0; i < ARRAY_SIZE(pools); i++) {
+		uint64_t single = bench_chain(pools[i].pool, chain_alloc_single);
+		uint64_t batch = bench_chain(pools[i].pool, chain_alloc_batch);
+
+		TC_PRINT("%-8s %9llu ns %9llu ns\n", pools[i].name, single, batch);
+	}
+
+	timing_stop();
+}
+
+static void *net_buf_perf_setup(void)
+{
+	timing_init();
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_buf_perf, NULL, net_buf_perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,92 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the number of cycles tracing adds to a traced kernel call, here
+ * k_sem_give() on a semaphore nobody waits for.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <tracing_core.h>
+
+#define NUM_BATCHES 64
+#define BATCH_SIZE  16
+
+static K_SEM_DEFINE(bench_sem, 0, K_SEM_MAX_LIMIT);
+
+static void tracing_set(bool enable)
+{
+	char cmd[8];
+
+	strcpy(cmd, enable ? "enable" : "disable");
+	tracing_cmd_handle((uint8_t *)cmd, strlen(cmd));
+}
+
+static uint64_t measure_sem_give(void)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+
+	for (int i = 0; i < NUM_BATCHES; i++) {
+		start = timing_counter_get();
+		for (int j = 0; j < BATCH_SIZE; j++) {
+			k_sem_give(&bench_sem);
+		}
+		finish = timing_counter_get();
+
+		cycles += timing_cycles_get(&start, &finish);
+
+		k_sem_reset(&bench_sem);
+		/* Let the tracing thread drain the tracing buffers */
+		k_msleep(CONFIG_TRACING_THREAD_WAIT_THRESHOLD + 1);
+	}
+
+	return cycles / (NUM_BATCHES * BATCH_SIZE);
+}
+
+static void report(const char *tag, const char *descr, uint64_t cycles)
+{
+	printk("REC: %-32s - %-40s : %7llu cycles , %7u ns :\n", tag, descr, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+}
+
+int main(void)
+{
+	uint64_t off;
+	uint64_t on;
+
+	timing_init();
+	timing_start();
+
+	printk("Tracing overhead with %s tracing buffers\n",
+	       IS_ENABLED(CONFIG_TRACING_BUFFER_PER_CPU) ? "per-CPU" : "global");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Warm up */
+	(void)measure_sem_give();
+
+	tracing_set(false);
+	off = measure_sem_give();
+
+	tracing_set(true);
+	on = measure_sem_give();
+
+	timing_stop();
+
+	report("tracing.k_sem_give.off", "k_sem_give, tracing disabled", off);
+	report("tracing.k_sem_give.on", "k_sem_give, tracing enabled", on);
+	report("tracing.k_sem_give.overhead", "k_sem_give, tracing overhead",
+	       (on > off) ? (on - off) : 0);
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -136,6 +136,30 @@ ZTEST_USER(device, test_bogus_dynamic_name)
 	zassert_true(mux == NULL);
 }
 
+/**
+ * @brief Test device binding for every device
+ *
+ * Validates that every device is found by its name, whether it is
+ * defined from the devicetree or not.
+ *
+ * @see device_get_binding()
+ */
+ZTEST(device, test_binding_all_devices)
+{
+	char name[Z_DEVICE_MAX_NAME_LEN];
+
+	STRUCT_SECTION_FOREACH(device, dev) {
+		/* Use a copy so the device is not found by address */
+		snprintk(name, sizeof(name), "%s", dev->name);
+
+		if (device_is_ready(dev)) {
+			zassert_equal_ptr(device_get_binding(name), dev, "%s", name);
+		} else {
+			zassert_is_null(device_get_binding(name), "%s", name);
+		}
+	}
+}
+
 /**
  * @brief Test device binding for passing null name
  *
@@ -0,0 +1,94 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT vnd_init_test
+
+struct init_test_config {
+	uint32_t delay_ms;
+};
+
+struct init_test_data {
+	int64_t start;
+	int64_t end;
+};
+
+static int64_t barrier_time;
+
+static int init_test_init(const struct device *dev)
+{
+	const struct init_test_config *config = dev->config;
+	struct init_test_data *data = dev->data;
+
+	data->start = k_uptime_get();
+	k_msleep(config->delay_ms);
+	data->end = k_uptime_get();
+
+	return 0;
+}
+
+#define INIT_TEST_DEFINE(inst)                                                                     \
+	static const struct init_test_config init_test_config_##inst = {                           \
+		.delay_ms = DT_INST_PROP(inst, delay_ms),                                          \
+	};                                                                                         \
+	static struct init_test_data init_test_data_##inst;                                        \
+	DEVICE_DT_INST_DEFINE(inst, init_test_init, NULL, &init_test_data_##inst,                  \
+			      &init_test_config_##inst, POST_KERNEL,                               \
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(INIT_TEST_DEFINE)
+
+static int barrier_init(void)
+{
+	barrier_time = k_uptime_get();
+
+	return 0;
+}
+
+SYS_INIT(barrier_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
+
+#define DATA(label) ((struct init_test_data *)DEVICE_DT_GET(DT_NODELABEL(label))->data)
+
+ZTEST(device_init_parallel, test_dependencies)
+{
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(init_slow))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(init_child))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(init_other))));
+
+	zassert_true(DATA(init_child)->start >= DATA(init_slow)->end);
+}
+
+ZTEST(device_init_parallel, test_concurrency)
+{
+	struct init_test_data *slow = DATA(init_slow);
+	struct init_test_data *other = DATA(init_other);
+	bool overlap = (other->start < slow->end) && (slow->start < other->end);
+
+	/* Not related in the devicetree, so they sleep at the same time */
+	zassert_equal(overlap, IS_ENABLED(CONFIG_DEVICE_INIT_PARALLEL));
+}
+
+ZTEST(device_init_parallel, test_sys_init_barrier)
+{
+	/* The SYS_INIT() is linked after the devices of the same priority */
+	zassert_true(barrier_time >= DATA(init_slow)->end);
+	zassert_true(barrier_time >= DATA(init_child)->end);
+	zassert_true(barrier_time >= DATA(init_other)->end);
+}
+
+ZTEST(device_init_parallel, test_init_time)
+{
+	uint32_t us = device_init_time_get(DEVICE_DT_GET(DT_NODELABEL(init_slow)));
+
+	zassert_true(us >= 50 * USEC_PER_MSEC, "%u us", us);
+	zassert_true(us < 100 * USEC_PER_MSEC, "%u us", us);
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
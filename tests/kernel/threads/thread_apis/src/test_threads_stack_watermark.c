@@ -0,0 +1,88 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include "tests_thread_apis.h"
+
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+
+#define WATERMARK_STACK_SIZE (2048 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WATERMARK_DEPTH      1024
+
+static K_THREAD_STACK_DEFINE(watermark_stack, WATERMARK_STACK_SIZE);
+static struct k_thread watermark_thread;
+static K_SEM_DEFINE(watermark_ready, 0, 1);
+static K_SEM_DEFINE(watermark_done, 0, 1);
+
+static __noinline void stack_grow(void)
+{
+	volatile uint8_t buf[WATERMARK_DEPTH];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+
+	/* Get switched out with the buffer on the stack */
+	k_sem_give(&watermark_ready);
+	k_sem_take(&watermark_done, K_FOREVER);
+
+	zassert_equal(buf[WATERMARK_DEPTH - 1], (uint8_t)(WATERMARK_DEPTH - 1));
+}
+
+static void watermark_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	stack_grow();
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
+/**
+ * @ingroup kernel_thread_tests
+ * @brief Check the stack high-water mark of a thread
+ *
+ * @details Create a thread that puts a buffer of a known size on its stack
+ * and blocks while the buffer is in use. The high-water mark sampled when
+ * it is switched out must cover the buffer and fit in the stack, and be
+ * cleared by a reset.
+ *
+ * @see k_thread_stack_watermark_get(), k_thread_stack_watermark_reset()
+ */
+ZTEST(threads_lifecycle, test_thread_stack_watermark)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_THREAD_STACK_WATERMARK);
+	/* Threads run on the host stacks, out of their stack buffer */
+	Z_TEST_SKIP_IFDEF(CONFIG_ARCH_POSIX);
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	size_t used;
+	int ret;
+
+	k_thread_create(&watermark_thread, watermark_stack, WATERMARK_STACK_SIZE,
+			watermark_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sem_take(&watermark_ready, K_FOREVER);
+
+	ret = k_thread_stack_watermark_get(&watermark_thread, &used);
+	zassert_equal(ret, 0, "failed to get the stack high-water mark");
+	zassert_true(used >= WATERMARK_DEPTH, "high-water mark %zu below %d",
+		     used, WATERMARK_DEPTH);
+	zassert_true(used <= watermark_thread.stack_info.size,
+		     "high-water mark %zu above the stack size %zu", used,
+		     watermark_thread.stack_info.size);
+
+	k_thread_stack_watermark_reset(&watermark_thread);
+	ret = k_thread_stack_watermark_get(&watermark_thread, &used);
+	zassert_equal(ret, 0, "failed to get the stack high-water mark");
+	zassert_equal(used, 0, "high-water mark not reset");
+
+	k_sem_give(&watermark_done);
+	k_thread_join(&watermark_thread, K_FOREVER);
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+}
@@ -554,5 +554,80 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_WAIT
+/**
+ * @brief Helper thread to test_thread_stats_wait()
+ */
+void helper2(void *p1, void *p2, void *p3)
+{
+}
+
+#if CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS > 0
+static uint32_t hist_sum(const uint32_t *hist)
+{
+	uint32_t  sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+#endif
+
+/**
+ * @brief Test the ready and blocked wait fields of k_thread_runtime_stats_get()
+ *
+ * 1. Create a low priority helper thread, and busy wait for 20 ms.
+ *    - Helper waits in the run queue for the whole busy wait.
+ * 2. Sleep for 20 ms. Helper runs and exits.
+ *    - Main thread is blocked for the whole sleep.
+ */
+ZTEST(usage_api, test_thread_stats_wait)
+{
+	uint64_t  min_cycles = (uint64_t)sys_clock_hw_cycles_per_sec() / 100U;
+	k_thread_runtime_stats_t  main_stats1;
+	k_thread_runtime_stats_t  main_stats2;
+	k_thread_runtime_stats_t  helper_stats;
+	k_tid_t  tid;
+
+	k_thread_runtime_stats_get(_current, &main_stats1);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper2, NULL, NULL, NULL,
+			      k_thread_priority_get(_current) + 2, 0, K_NO_WAIT);
+
+	k_busy_wait(20 * USEC_PER_MSEC);
+
+	/* Wait in progress is reported */
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+	zassert_true(helper_stats.ready_wait_cycles >= min_cycles);
+	zassert_equal(helper_stats.num_ready_waits, 0);
+
+	k_msleep(20);
+	k_thread_join(tid, K_FOREVER);
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+	k_thread_runtime_stats_get(_current, &main_stats2);
+
+	zassert_true(helper_stats.ready_wait_cycles >= min_cycles);
+	zassert_true(helper_stats.peak_ready_wait_cycles >= min_cycles);
+	zassert_true(helper_stats.num_ready_waits >= 1);
+
+	zassert_true(main_stats2.blocked_cycles - main_stats1.blocked_cycles >= min_cycles);
+	zassert_true(main_stats2.peak_blocked_cycles >= min_cycles);
+	zassert_true(main_stats2.num_blocks > main_stats1.num_blocks);
+
+#if CONFIG_SCHED_THREAD_USAGE_WAIT_HISTOGRAM_BUCKETS > 0
+	/* Waits are counted once they end */
+
+	zassert_equal(hist_sum(helper_stats.ready_wait_histogram), helper_stats.num_ready_waits);
+	zassert_equal(hist_sum(main_stats2.blocked_histogram), main_stats2.num_blocks);
+#endif
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_WAIT */
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -607,6 +607,72 @@ ZTEST(libc_common, test_memmove)
 		     "memmove failed");
 }
 
+/**
+ * @brief Test memory and string functions on all alignments
+ *
+ * @details The optimized implementations have separate paths for the
+ * unaligned head, the word or vector sized body and the tail, so compare
+ * them against the trivial definitions for every alignment and for lengths
+ * spanning several blocks.
+ *
+ * @see memcpy(), memmove(), memset(), memcmp(), memchr(), strlen().
+ */
+ZTEST(libc_common, test_mem_alignment)
+{
+	static unsigned char buf_a[96];
+	static unsigned char buf_b[96];
+	static unsigned char ref[96];
+	const size_t max_len = 64;
+
+	for (size_t off_a = 0; off_a < 16; off_a++) {
+		for (size_t off_b = 0; off_b < 16; off_b++) {
+			for (size_t len = 0; len <= max_len; len++) {
+				unsigned char *a = &buf_a[off_a];
+				unsigned char *b = &buf_b[off_b];
+
+				for (size_t i = 0; i < sizeof(buf_a); i++) {
+					buf_a[i] = (unsigned char)(i + 1);
+					buf_b[i] = 0xaa;
+				}
+
+				zassert_equal(memcpy(b, a, len), b);
+				zassert_mem_equal(b, a, len);
+				zassert_equal(buf_b[off_b + len], 0xaa, "memcpy overrun");
+				zassert_equal(memcmp(a, b, len), 0);
+
+				if (len > 0) {
+					/* difference in the last byte */
+					b[len - 1]--;
+					zassert_true(memcmp(a, b, len) > 0);
+					zassert_true(memcmp(b, a, len) < 0);
+					b[len - 1]++;
+				}
+
+				zassert_equal(memchr(a, 0, len), NULL);
+				if (len > 0) {
+					a[len - 1] = 0;
+					zassert_equal(memchr(a, 0, len), &a[len - 1]);
+					zassert_equal(strlen((char *)a), len - 1);
+				}
+
+				memset(b, 0x55, len);
+				for (size_t i = 0; i < len; i++) {
+					zassert_equal(b[i], 0x55, "memset at %zu", i);
+				}
+				zassert_equal(buf_b[off_b + len], 0xaa, "memset overrun");
+
+				/* overlapping moves in both directions */
+				memcpy(ref, buf_a, sizeof(ref));
+				memmove(&buf_a[off_b], &buf_a[off_a], len);
+				for (size_t i = 0; i < len; i++) {
+					zassert_equal(buf_a[off_b + i], ref[off_a + i],
+						      "memmove %zu->%zu len %zu", off_a, off_b, len);
+				}
+			}
+		}
+	}
+}
+
 /**
  *
  * @brief test str operate functions
@@ -2927,4 +2927,178 @@ ZTEST(lib_json_test, test_debug_string_types)
 	zassert_str_equal(decoded.string_buf, "buffer\ttab", "string_buf not unescaped");
 }
 
+ZTEST(lib_json_test, test_json_decoding_field_order)
+{
+	struct test_nested ts = { 0 };
+	char encoded[] = "{\"nested_uint64\":7,\"nested_int64\":-6,\"extra\":[1,{\"a\":2}],"
+			 "\"nested_uint8\":5,\"nested_int8\":-4,\"nested_string_buf\":\"b\","
+			 "\"nested_int\":1,\"nested_bool\":true,\"nested_int\":2,"
+			 "\"nested_string\":\"a\"}";
+	int64_t ret;
+
+	/* Fields in reverse order, with an unknown and a duplicate key */
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, nested_descr,
+			     ARRAY_SIZE(nested_descr), &ts);
+
+	zassert_equal(ret, BIT_MASK(ARRAY_SIZE(nested_descr)), "Not all fields decoded");
+	zassert_equal(ts.nested_int, 1);
+	zassert_true(ts.nested_bool);
+	zassert_str_equal(ts.nested_string, "a");
+	zassert_str_equal(ts.nested_string_buf, "b");
+	zassert_equal(ts.nested_int8, -4);
+	zassert_equal(ts.nested_uint8, 5);
+	zassert_equal(ts.nested_int64, -6);
+	zassert_equal(ts.nested_uint64, 7);
+}
+
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+struct stream_elt {
+	char name[10];
+	int height;
+};
+
+struct stream_test {
+	char name[16];
+	int value;
+	bool flag;
+	int64_t big;
+	struct {
+		uint8_t small;
+		char tag[8];
+	} nested;
+	int numbers[4];
+	size_t numbers_len;
+	struct stream_elt elts[3];
+	size_t elts_len;
+};
+
+static const struct json_obj_descr stream_elt_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct stream_elt, name, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct stream_elt, height, JSON_TOK_NUMBER),
+};
+
+static const struct json_obj_descr stream_nested_descr[] = {
+	JSON_OBJ_DESCR_PRIM(__typeof__(((struct stream_test *)0)->nested), small, JSON_TOK_UINT),
+	JSON_OBJ_DESCR_PRIM(__typeof__(((struct stream_test *)0)->nested), tag,
+			    JSON_TOK_STRING_BUF),
+};
+
+static const struct json_obj_descr stream_test_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct stream_test, name, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct stream_test, value, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct stream_test, flag, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct stream_test, big, JSON_TOK_INT64),
+	JSON_OBJ_DESCR_OBJECT(struct stream_test, nested, stream_nested_descr),
+	JSON_OBJ_DESCR_ARRAY(struct stream_test, numbers, 4, numbers_len, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct stream_test, elts, 3, elts_len, stream_elt_descr,
+				 ARRAY_SIZE(stream_elt_descr)),
+};
+
+static const char stream_test_json[] =
+	"{ \"name\" : \"zep\\\"hyr\\n\",\n"
+	"\"unknown\": {\"a\": [1, \"]}\", {\"b\": null}], \"c\": \"\\\\\"},"
+	"\"value\":-42,\"flag\":true,\"big\":-4611686018427387904,"
+	"\"nested\":{\"tag\":\"t\",\"small\":200,\"more\":[[]]},"
+	"\"long_unknown\":\"" "0123456789012345678901234567890123456789"
+	"0123456789012345678901234567890123456789" "\","
+	"\"numbers\":[1,2,\t3],"
+	"\"elts\":[{\"name\":\"a\",\"height\":1},{\"height\":2,\"name\":\"b\"},{}]"
+	"}\n";
+
+static int64_t stream_parse(const char *json, size_t len, size_t chunk, struct stream_test *st)
+{
+	struct json_obj_stream stream;
+	int ret;
+
+	memset(st, 0, sizeof(*st));
+	json_obj_stream_init(&stream, stream_test_descr, ARRAY_SIZE(stream_test_descr), st);
+
+	for (size_t pos = 0; pos < len; pos += chunk) {
+		ret = json_obj_stream_feed(&stream, json + pos, MIN(chunk, len - pos));
+		if (ret < 0) {
+			zassert_equal(json_obj_stream_finish(&stream), ret, "Error not kept");
+			return ret;
+		}
+	}
+
+	return json_obj_stream_finish(&stream);
+}
+
+ZTEST(lib_json_test, test_json_stream_decoding)
+{
+	struct stream_test st;
+	char buf[sizeof(stream_test_json)];
+	int64_t ret;
+
+	for (size_t chunk = 1; chunk <= sizeof(stream_test_json); chunk++) {
+		ret = stream_parse(stream_test_json, sizeof(stream_test_json) - 1, chunk, &st);
+
+		zassert_equal(ret, BIT_MASK(ARRAY_SIZE(stream_test_descr)),
+			      "Not all fields decoded with chunks of %zu", chunk);
+		zassert_str_equal(st.name, "zep\"hyr\n");
+		zassert_equal(st.value, -42);
+		zassert_true(st.flag);
+		zassert_equal(st.big, -4611686018427387904LL);
+		zassert_equal(st.nested.small, 200);
+		zassert_str_equal(st.nested.tag, "t");
+		zassert_equal(st.numbers_len, 3);
+		zassert_equal(st.numbers[2], 3);
+		zassert_equal(st.elts_len, 3);
+		zassert_str_equal(st.elts[0].name, "a");
+		zassert_equal(st.elts[1].height, 2);
+		zassert_str_equal(st.elts[1].name, "b");
+		zassert_equal(st.elts[2].height, 0);
+	}
+
+	/* Same result as the in-place parser */
+	memcpy(buf, stream_test_json, sizeof(buf));
+	memset(&st, 0, sizeof(st));
+	ret = json_obj_parse(buf, sizeof(buf) - 1, stream_test_descr,
+			     ARRAY_SIZE(stream_test_descr), &st);
+	zassert_equal(ret, BIT_MASK(ARRAY_SIZE(stream_test_descr)));
+	zassert_str_equal(st.name, "zep\"hyr\n");
+	zassert_equal(st.elts_len, 3);
+}
+
+ZTEST(lib_json_test, test_json_stream_errors)
+{
+	static const char *const invalid[] = {
+		"[]",
+		"{\"value\":1",
+		"{\"value\":1,}",
+		"{\"value\" 1}",
+		"{\"value\":\"1\"}",
+		"{\"value\":1x}",
+		"{\"value\":tru}",
+		"{\"value\":null}",
+		"{\"name\":\"\\x\"}",
+		"{\"name\":\"01234567890123456789\"}",
+		"{\"numbers\":[1,2,3,4,5]}",
+		"{\"numbers\":[1}",
+		"{\"nested\":[]}",
+		"{\"elts\":[{\"height\":1]}",
+	};
+	static const struct json_obj_descr pointer_descr[] = {
+		JSON_OBJ_DESCR_PRIM(struct test_nested, nested_string, JSON_TOK_STRING),
+	};
+	struct json_obj_stream stream;
+	struct test_nested tn;
+	struct stream_test st;
+
+	ARRAY_FOR_EACH(invalid, i) {
+		zassert_true(stream_parse(invalid[i], strlen(invalid[i]), 1, &st) < 0,
+			     "Accepted %s", invalid[i]);
+		zassert_true(stream_parse(invalid[i], strlen(invalid[i]), 64, &st) < 0,
+			     "Accepted %s", invalid[i]);
+	}
+
+	/* Fields pointing into the input cannot be decoded */
+	json_obj_stream_init(&stream, pointer_descr, ARRAY_SIZE(pointer_descr), &tn);
+	zassert_equal(json_obj_stream_feed(&stream, "{\"nested_string\":\"a\"}", 21), -ENOTSUP);
+
+	/* Nothing decoded, and data after the object ignored */
+	zassert_equal(stream_parse("{} {", 4, 1, &st), 0);
+}
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
@@ -69,11 +69,14 @@ static void fixed_destroy(struct net_buf *buf);
 static void var_destroy(struct net_buf *buf);
 static void var_destroy_aligned(struct net_buf *buf);
 static void var_destroy_aligned_small(struct net_buf *buf);
+static void arena_destroy(struct net_buf *buf);
 
 #define VAR_POOL_ALIGN 8
 #define VAR_POOL_ALIGN_SMALL 4
 #define VAR_POOL_DATA_COUNT 4
 #define VAR_POOL_DATA_SIZE (VAR_POOL_DATA_COUNT * 64)
+#define ARENA_POOL_BLOCK_SIZE 128
+#define ARENA_POOL_BLOCK_COUNT 2
 
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
@@ -89,6 +92,10 @@ NET_BUF_POOL_VAR_ALIGN_DEFINE(var_pool_aligned, VAR_POOL_DATA_COUNT,
 NET_BUF_POOL_VAR_ALIGN_DEFINE(var_pool_aligned_small, VAR_POOL_DATA_COUNT,
 			      VAR_POOL_DATA_SIZE, USER_DATA_VAR,
 			      var_destroy_aligned_small, VAR_POOL_ALIGN_SMALL);
+NET_BUF_POOL_FIXED_DEFINE(frag_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
+NET_BUF_POOL_VAR_ARENA_DEFINE(arena_pool, 6,
+			      ARENA_POOL_BLOCK_COUNT * ARENA_POOL_BLOCK_SIZE,
+			      ARENA_POOL_BLOCK_SIZE, USER_DATA_VAR, arena_destroy);
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -135,6 +142,15 @@ static void var_destroy_aligned_small(struct net_buf *buf)
 	net_buf_destroy(buf);
 }
 
+static void arena_destroy(struct net_buf *buf)
+{
+	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+
+	destroy_called++;
+	zassert_equal(pool, &arena_pool, "Invalid free pointer in buffer");
+	net_buf_destroy(buf);
+}
+
 static const char example_data[] = "0123456789"
 				   "abcdefghijklmnopqrstuvxyz"
 				   "!#¤%&/()=?";
@@ -1163,4 +1179,165 @@ ZTEST(net_buf_tests, test_net_buf_var_pool_aligned)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_alloc_batch)
+{
+	struct net_buf *bufs[10];
+	struct net_buf *buf;
+	int err;
+
+	destroy_called = 0;
+
+	err = net_buf_alloc_batch(&var_pool, 50, bufs, 11);
+	zassert_equal(err, -EINVAL, "More buffers than the pool has allocated");
+
+	err = net_buf_alloc_batch(&var_pool, 50, bufs, 6);
+	zassert_equal(err, 0, "Failed to allocate buffers");
+
+	for (int i = 0; i < 6; i++) {
+		zassert_not_null(bufs[i]->data, "Buffer without data");
+		zassert_true(bufs[i]->size >= 50, "Invalid buffer size");
+		zassert_equal(bufs[i]->ref, 1, "Invalid buffer reference count");
+		zassert_equal(bufs[i]->len, 0, "Invalid buffer length");
+		net_buf_add_mem(bufs[i], example_data, 10);
+		if (i > 0) {
+			net_buf_frag_add(bufs[0], bufs[i]);
+		}
+	}
+
+	zassert_equal(net_buf_frags_len(bufs[0]), 60, "Invalid chain length");
+
+	/* Only four buffers are left, nothing may be taken */
+	err = net_buf_alloc_batch(&var_pool, 50, &bufs[6], 5);
+	zassert_equal(err, -ENOMEM, "Allocated more buffers than available");
+
+	err = net_buf_alloc_batch(&var_pool, 50, &bufs[6], 4);
+	zassert_equal(err, 0, "Failed to allocate remaining buffers");
+
+	buf = net_buf_alloc_len(&var_pool, 50, K_NO_WAIT);
+	zassert_is_null(buf, "Allocated more buffers than the pool has");
+
+	for (int i = 6; i < 10; i++) {
+		net_buf_unref(bufs[i]);
+	}
+
+	net_buf_unref(bufs[0]);
+
+	zassert_equal(destroy_called, 10, "Incorrect destroy callback count");
+
+	/* Not enough data is left for all buffers, so none is allocated */
+	err = net_buf_alloc_batch(&var_pool, 400, bufs, 3);
+	zassert_equal(err, -ENOMEM, "Allocated more data than available");
+	zassert_equal(destroy_called, 12, "Incorrect destroy callback count");
+
+	err = net_buf_alloc_batch(&var_pool, 0, bufs, 10);
+	zassert_equal(err, 0, "Pool buffers were lost");
+
+	for (int i = 0; i < 10; i++) {
+		zassert_is_null(bufs[i]->__buf, "Buffer with data");
+		net_buf_unref(bufs[i]);
+	}
+}
+
+ZTEST(net_buf_tests, test_net_buf_unref_chain)
+{
+	struct net_buf *frags[10];
+	struct net_buf *head;
+
+	/* Without destroy callback, the fragments go back to the pool in
+	 * batches.
+	 */
+	head = net_buf_alloc_len(&frag_pool, 0, K_NO_WAIT);
+	zassert_not_null(head, "Failed to get buffer");
+
+	for (int i = 0; i < 9; i++) {
+		frags[i] = net_buf_alloc_len(&frag_pool, 0, K_NO_WAIT);
+		zassert_not_null(frags[i], "Failed to get fragment");
+		net_buf_frag_add(head, frags[i]);
+	}
+
+	/* Chained to the bufs_pool head, so that pools alternate */
+	frags[9] = net_buf_alloc_len(&bufs_pool, 0, K_NO_WAIT);
+	zassert_not_null(frags[9], "Failed to get buffer");
+	net_buf_frag_insert(frags[4], frags[9]);
+
+	/* A fragment still referenced elsewhere stops the release */
+	zassert_equal_ptr(net_buf_ref(frags[6]), frags[6], "Failed to reference fragment");
+	net_buf_unref(head);
+	zassert_equal(atomic_get(&frag_pool.avail_count), 7, "Buffers not put back");
+	zassert_equal(atomic_get(&bufs_pool.avail_count), 10, "Buffer not put back");
+
+	net_buf_unref(frags[6]);
+	zassert_equal(atomic_get(&frag_pool.avail_count), 10, "Buffers not put back");
+
+	for (int i = 0; i < 10; i++) {
+		frags[i] = net_buf_alloc_len(&frag_pool, 0, K_NO_WAIT);
+		zassert_not_null(frags[i], "Buffer %d was not put back", i);
+	}
+
+	zassert_is_null(net_buf_alloc_len(&frag_pool, 0, K_NO_WAIT),
+			"Buffer put back more than once");
+
+	for (int i = 0; i < 10; i++) {
+		net_buf_unref(frags[i]);
+	}
+}
+
+ZTEST(net_buf_tests, test_net_buf_arena_pool)
+{
+	struct net_buf *bufs[6];
+	struct net_buf *clone;
+	uint8_t *first;
+
+	destroy_called = 0;
+
+	bufs[0] = net_buf_alloc_len(&arena_pool, 40, K_NO_WAIT);
+	zassert_not_null(bufs[0], "Failed to get buffer");
+	first = bufs[0]->__buf;
+
+	bufs[1] = net_buf_alloc_len(&arena_pool, 40, K_NO_WAIT);
+	zassert_not_null(bufs[1], "Failed to get buffer");
+
+	/* Payloads are carved sequentially out of a block */
+	zassert_true(bufs[1]->__buf > first, "Payloads not allocated in order");
+	zassert_true(bufs[1]->__buf - first < ARENA_POOL_BLOCK_SIZE,
+		     "Payloads not allocated from the same block");
+
+	zassert_is_null(net_buf_alloc_len(&arena_pool, ARENA_POOL_BLOCK_SIZE, K_NO_WAIT),
+			"Allocated payload larger than a block");
+
+	/* Doesn't fit in the first block anymore */
+	bufs[2] = net_buf_alloc_len(&arena_pool, 100, K_NO_WAIT);
+	zassert_not_null(bufs[2], "Failed to get buffer");
+
+	clone = net_buf_clone(bufs[2], K_NO_WAIT);
+	zassert_not_null(clone, "Failed to clone buffer");
+	zassert_equal(clone->__buf, bufs[2]->__buf, "Cloned data doesn't match");
+
+	/* Both blocks are in use */
+	zassert_is_null(net_buf_alloc_len(&arena_pool, 100, K_NO_WAIT),
+			"Allocated more blocks than the arena has");
+
+	/* The first block is freed by its last payload and can be reused */
+	net_buf_unref(bufs[0]);
+	net_buf_unref(bufs[1]);
+
+	bufs[3] = net_buf_alloc_len(&arena_pool, 100, K_NO_WAIT);
+	zassert_not_null(bufs[3], "Freed block was not reused");
+	zassert_equal_ptr(bufs[3]->__buf, first, "Freed block was not reused");
+
+	net_buf_unref(bufs[2]);
+	net_buf_unref(clone);
+	net_buf_unref(bufs[3]);
+
+	zassert_equal(destroy_called, 5, "Incorrect destroy callback count");
+
+	/* Everything was freed, a batch fills both blocks again */
+	zassert_equal(net_buf_alloc_batch(&arena_pool, 50, bufs, 4), 0,
+		      "Failed to allocate buffers");
+
+	for (int i = 0; i < 4; i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
 ZTEST_SUITE(net_buf_tests, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,185 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/ring_buffer_spsc.h>
+#include <stdint.h>
+
+#define SPSC_SIZE 37
+
+RING_BUF_SPSC_DECLARE(spsc_rb, SPSC_SIZE);
+
+static void spsc_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	ring_buf_spsc_reset(&spsc_rb);
+}
+
+ZTEST(ringbuffer_spsc, test_spsc_put_get)
+{
+	uint8_t in[SPSC_SIZE + 5];
+	uint8_t out[SPSC_SIZE + 5];
+
+	for (int i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)i;
+	}
+
+	zassert_true(ring_buf_spsc_is_empty(&spsc_rb));
+	zassert_equal(ring_buf_spsc_capacity_get(&spsc_rb), SPSC_SIZE);
+	zassert_equal(ring_buf_spsc_space_get(&spsc_rb), SPSC_SIZE);
+
+	/* only the free space is written */
+	zassert_equal(ring_buf_spsc_put(&spsc_rb, in, sizeof(in)), SPSC_SIZE);
+	zassert_equal(ring_buf_spsc_space_get(&spsc_rb), 0);
+	zassert_equal(ring_buf_spsc_size_get(&spsc_rb), SPSC_SIZE);
+	zassert_equal(ring_buf_spsc_put(&spsc_rb, in, 1), 0);
+
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, out, 10), 10);
+	zassert_mem_equal(out, in, 10);
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, NULL, 5), 5);
+
+	/* wraps around the end of the buffer */
+	zassert_equal(ring_buf_spsc_put(&spsc_rb, in, 15), 15);
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, out, sizeof(out)), SPSC_SIZE);
+	zassert_mem_equal(out, &in[15], SPSC_SIZE - 15);
+	zassert_mem_equal(&out[SPSC_SIZE - 15], in, 15);
+	zassert_true(ring_buf_spsc_is_empty(&spsc_rb));
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, out, sizeof(out)), 0);
+}
+
+ZTEST(ringbuffer_spsc, test_spsc_claim)
+{
+	struct ring_buf_spsc_vec vec[2];
+	uint8_t in[SPSC_SIZE] = {0};
+
+	zassert_equal(ring_buf_spsc_put(&spsc_rb, in, 30), 30);
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, NULL, 30), 30);
+
+	/* all the free space is claimed at once, in two areas */
+	zassert_equal(ring_buf_spsc_put_claim(&spsc_rb, vec, UINT32_MAX), SPSC_SIZE);
+	zassert_equal(vec[0].len, SPSC_SIZE - 30);
+	zassert_equal(vec[1].len, 30);
+	zassert_equal_ptr(vec[1].data, vec[0].data - 30);
+
+	for (uint32_t i = 0; i < vec[0].len; i++) {
+		vec[0].data[i] = (uint8_t)i;
+	}
+	for (uint32_t i = 0; i < vec[1].len; i++) {
+		vec[1].data[i] = (uint8_t)(vec[0].len + i);
+	}
+
+	zassert_equal(ring_buf_spsc_put_finish(&spsc_rb, SPSC_SIZE + 1), -EINVAL);
+	zassert_equal(ring_buf_spsc_size_get(&spsc_rb), 0);
+	zassert_equal(ring_buf_spsc_put_finish(&spsc_rb, 20), 0);
+	zassert_equal(ring_buf_spsc_size_get(&spsc_rb), 20);
+
+	zassert_equal(ring_buf_spsc_get_claim(&spsc_rb, vec, UINT32_MAX), 20);
+	zassert_equal(vec[0].len, SPSC_SIZE - 30);
+	zassert_equal(vec[1].len, 20 - (SPSC_SIZE - 30));
+	zassert_equal(vec[1].data[0], SPSC_SIZE - 30);
+
+	zassert_equal(ring_buf_spsc_get_finish(&spsc_rb, 21), -EINVAL);
+	zassert_equal(ring_buf_spsc_get_finish(&spsc_rb, 20), 0);
+	zassert_true(ring_buf_spsc_is_empty(&spsc_rb));
+}
+
+ZTEST(ringbuffer_spsc, test_spsc_vec)
+{
+	uint8_t a[5] = {0, 1, 2, 3, 4};
+	uint8_t b[40];
+	uint8_t c[3];
+	uint8_t d[40];
+	const struct ring_buf_spsc_vec put_vec[] = {
+		{.data = a, .len = sizeof(a)},
+		{.data = NULL, .len = 0},
+		{.data = b, .len = sizeof(b)},
+	};
+	const struct ring_buf_spsc_vec get_vec[] = {
+		{.data = c, .len = sizeof(c)},
+		{.data = NULL, .len = 4},
+		{.data = d, .len = sizeof(d)},
+	};
+
+	for (int i = 0; i < sizeof(b); i++) {
+		b[i] = (uint8_t)(sizeof(a) + i);
+	}
+
+	/* move the indices so that data wraps */
+	zassert_equal(ring_buf_spsc_put(&spsc_rb, b, 20), 20);
+	zassert_equal(ring_buf_spsc_get(&spsc_rb, NULL, 20), 20);
+
+	zassert_equal(ring_buf_spsc_putv(&spsc_rb, put_vec, ARRAY_SIZE(put_vec)), SPSC_SIZE);
+	zassert_equal(ring_buf_spsc_getv(&spsc_rb, get_vec, ARRAY_SIZE(get_vec)), SPSC_SIZE);
+	zassert_mem_equal(c, a, sizeof(c));
+	zassert_mem_equal(d, &b[sizeof(c) + 4 - sizeof(a)], SPSC_SIZE - sizeof(c) - 4);
+}
+
+static bool spsc_produce(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	static uint8_t cnt;
+	static uint32_t wr = 1;
+	struct ring_buf_spsc_vec vec[2];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	len = ring_buf_spsc_put_claim(&spsc_rb, vec, wr);
+	for (int v = 0; v < ARRAY_SIZE(vec); v++) {
+		for (uint32_t i = 0; i < vec[v].len; i++) {
+			vec[v].data[i] = cnt++;
+		}
+	}
+
+	zassert_equal(ring_buf_spsc_put_finish(&spsc_rb, len), 0);
+
+	wr = (wr % SPSC_SIZE) + 1;
+
+	return true;
+}
+
+static bool spsc_consume(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	static uint8_t cnt;
+	static uint32_t rd = 3;
+	uint8_t buf[SPSC_SIZE];
+	uint32_t len;
+
+	if (iter_cnt == 0) {
+		cnt = 0;
+	}
+
+	len = ring_buf_spsc_get(&spsc_rb, buf, rd);
+	for (uint32_t i = 0; i < len; i++) {
+		zassert_equal(buf[i], cnt, "Got %02x, exp: %02x", buf[i], cnt);
+		cnt++;
+	}
+
+	rd = (rd % SPSC_SIZE) + 1;
+
+	return true;
+}
+
+/* Single producer, single consumer from different priorities, without locks. */
+ZTEST(ringbuffer_spsc, test_spsc_stress)
+{
+	k_timeout_t timeout = (CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? K_MSEC(1000) :
+									  K_MSEC(10000);
+
+	ztress_set_timeout(timeout);
+	ZTRESS_EXECUTE(ZTRESS_THREAD(spsc_produce, NULL, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(spsc_consume, NULL, 0, 2000, Z_TIMEOUT_TICKS(20)));
+
+	ring_buf_spsc_reset(&spsc_rb);
+
+	ztress_set_timeout(timeout);
+	ZTRESS_EXECUTE(ZTRESS_THREAD(spsc_consume, NULL, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(spsc_produce, NULL, 0, 2000, Z_TIMEOUT_TICKS(20)));
+}
+
+ZTEST_SUITE(ringbuffer_spsc, NULL, NULL, spsc_before, NULL, NULL);
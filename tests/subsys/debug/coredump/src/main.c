@@ -15,6 +15,9 @@
 struct k_thread crash_thread;
 K_THREAD_STACK_DEFINE(crash_stack, CONFIG_MAIN_STACK_SIZE);
 
+static uint32_t crash_state[16] = { 0xdeadbeef };
+COREDUMP_MEMORY_REGION_DEFINE(crash_state_region, crash_state, sizeof(crash_state));
+
 void k_sys_fatal_error_handler(unsigned int reason, const struct arch_esf *pEsf)
 {
 	ARG_UNUSED(pEsf);
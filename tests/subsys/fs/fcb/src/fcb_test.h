@@ -32,6 +32,11 @@ extern struct flash_sector test_fcb_sector[];
 
 extern uint8_t fcb_test_erase_value;
 
+#ifdef CONFIG_FCB_INDEX
+#define TEST_FCB_INDEX_SIZE 256
+extern struct fcb_index_entry test_fcb_index[TEST_FCB_INDEX_SIZE];
+#endif
+
 struct append_arg {
 	int *elem_cnts;
 };
@@ -0,0 +1,161 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+/* Tag entries with their first data byte */
+static uint32_t fcb_test_index_tag(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	uint8_t val = 0;
+
+	(void)flash_area_read(fcbp->fap, loc->fe_sector->fs_off + loc->fe_data_off, &val, sizeof(val));
+
+	return val;
+}
+
+static int fcb_test_index_append(struct fcb *fcb, uint8_t val, uint16_t len)
+{
+	struct fcb_entry loc;
+	uint8_t test_data[256];
+	int rc;
+
+	(void)memset(test_data, val, len);
+
+	rc = fcb_append(fcb, len, &loc);
+	if (rc) {
+		return rc;
+	}
+
+	rc = flash_area_write(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc), test_data, len);
+	zassert_true(rc == 0, "flash_area_write call failure");
+
+	return fcb_append_finish(fcb, &loc);
+}
+
+/* Entry locations of @p fcb in walk order, at most @p max */
+static int fcb_test_index_locs(struct fcb *fcb, struct fcb_entry *locs, int max)
+{
+	struct fcb_entry loc = { 0 };
+	int cnt = 0;
+
+	while (fcb_getnext(fcb, &loc) == 0) {
+		zassert_true(cnt < max, "too many entries");
+		locs[cnt++] = loc;
+	}
+
+	return cnt;
+}
+
+/* Check the index against a scan of the flash by an instance without index */
+static void fcb_test_index_check(struct fcb *fcb)
+{
+	static struct fcb scan_fcb;
+	static struct fcb_entry indexed[TEST_FCB_INDEX_SIZE];
+	static struct fcb_entry scanned[TEST_FCB_INDEX_SIZE];
+	int indexed_cnt;
+	int scanned_cnt;
+	int rc;
+
+	(void)memset(&scan_fcb, 0, sizeof(scan_fcb));
+	scan_fcb.f_sector_cnt = fcb->f_sector_cnt;
+	scan_fcb.f_sectors = fcb->f_sectors;
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, &scan_fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+
+	indexed_cnt = fcb_test_index_locs(fcb, indexed, ARRAY_SIZE(indexed));
+	scanned_cnt = fcb_test_index_locs(&scan_fcb, scanned, ARRAY_SIZE(scanned));
+	zassert_equal(indexed_cnt, scanned_cnt, "index and flash disagree");
+
+	for (int i = 0; i < scanned_cnt; i++) {
+		struct fcb_entry loc = { 0 };
+		uint32_t tag = fcb_test_index_tag(&scan_fcb, &scanned[i]);
+		bool found = false;
+
+		zassert_equal(indexed[i].fe_sector, scanned[i].fe_sector, "wrong sector");
+		zassert_equal(indexed[i].fe_elem_off, scanned[i].fe_elem_off, "wrong offset");
+		zassert_equal(indexed[i].fe_data_off, scanned[i].fe_data_off, "wrong data offset");
+		zassert_equal(indexed[i].fe_data_len, scanned[i].fe_data_len, "wrong data length");
+
+		/* Every entry is found by its tag, after the previous ones */
+		while (!found && fcb_index_find(fcb, tag, &loc) == 0) {
+			found = (loc.fe_sector == scanned[i].fe_sector &&
+				 loc.fe_elem_off == scanned[i].fe_elem_off);
+		}
+		zassert_true(found, "entry %d not found by tag", i);
+	}
+}
+
+static int fcb_test_index_count(struct fcb *fcb, uint8_t val)
+{
+	struct fcb_entry loc = { 0 };
+	int cnt = 0;
+
+	while (fcb_index_find(fcb, val, &loc) == 0) {
+		zassert_equal(fcb_test_index_tag(fcb, &loc), val, "wrong entry found");
+		cnt++;
+	}
+
+	return cnt;
+}
+
+ZTEST(fcb_test_with_2sectors_set, test_fcb_index)
+{
+	struct fcb *fcb;
+	struct fcb_entry loc;
+	int appended = 0;
+	int rc;
+
+	fcb = &test_fcb;
+
+	rc = fcb_index_attach(fcb, test_fcb_index, ARRAY_SIZE(test_fcb_index),
+			      fcb_test_index_tag);
+	zassert_true(rc == 0, "fcb_index_attach call failure");
+
+	for (int i = 0; i < 6; i++) {
+		rc = fcb_test_index_append(fcb, i % 3, 32);
+		zassert_true(rc == 0, "fcb append failure");
+	}
+
+	zassert_equal(fcb_test_index_count(fcb, 0), 2, "wrong number of entries");
+	zassert_equal(fcb_test_index_count(fcb, 1), 2, "wrong number of entries");
+	zassert_equal(fcb_test_index_count(fcb, 3), 0, "wrong number of entries");
+	fcb_test_index_check(fcb);
+
+	/* Re-initializing detaches the index */
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+	loc.fe_sector = NULL;
+	zassert_equal(fcb_index_find(fcb, 2, &loc), -ENOENT, "index still attached");
+
+	/* The index is rebuilt from flash when attached */
+	rc = fcb_index_attach(fcb, test_fcb_index, ARRAY_SIZE(test_fcb_index),
+			      fcb_test_index_tag);
+	zassert_true(rc == 0, "fcb_index_attach call failure");
+	zassert_equal(fcb_test_index_count(fcb, 2), 2, "wrong number of entries");
+	fcb_test_index_check(fcb);
+
+	/* Fill both sectors, rotate and check the dropped entries are gone.
+	 * Entries are large enough for the index not to overflow.
+	 */
+	while (fcb_test_index_append(fcb, 0xa5, 256) == 0) {
+		appended++;
+	}
+	zassert_true(appended > 0, "no entry appended");
+	fcb_test_index_check(fcb);
+
+	rc = fcb_rotate(fcb);
+	zassert_true(rc == 0, "fcb_rotate call failure");
+
+	zassert_equal(fcb_test_index_count(fcb, 0), 0, "rotated entries still indexed");
+	fcb_test_index_check(fcb);
+
+	/* fcb_getnext() is served from the index */
+	loc.fe_sector = NULL;
+	loc.fe_elem_off = 0;
+	rc = fcb_getnext(fcb, &loc);
+	zassert_true(rc == 0, "fcb_getnext call failure");
+	zassert_equal(fcb_test_index_tag(fcb, &loc), 0xa5, "wrong first entry");
+}
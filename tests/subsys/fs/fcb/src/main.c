@@ -20,6 +20,10 @@ struct fcb test_fcb_crc_disabled = { .f_flags = FCB_FLAGS_CRC_DISABLED };
 
 uint8_t fcb_test_erase_value;
 
+#ifdef CONFIG_FCB_INDEX
+struct fcb_index_entry test_fcb_index[TEST_FCB_INDEX_SIZE];
+#endif
+
 #if defined(CONFIG_SOC_SERIES_STM32H7X)
 	#define SECTOR_SIZE 0x20000 /* 128K */
 #else
@@ -127,6 +131,11 @@ void fcb_tc_pretest(int sectors, struct fcb *_fcb)
 		printf("%s rc == %xm, %d\n", __func__, rc, rc);
 		zassert_true(rc == 0, "fbc initialization failure");
 	}
+
+#ifdef CONFIG_FCB_INDEX
+	rc = fcb_index_attach(_fcb, test_fcb_index, ARRAY_SIZE(test_fcb_index), NULL);
+	zassert_true(rc == 0, "fcb_index_attach call failure");
+#endif
 }
 
 static void fcb_pretest_2_sectors(void *data)
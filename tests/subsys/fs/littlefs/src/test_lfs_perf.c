@@ -6,6 +6,7 @@
 
 /* littlefs performance testing */
 
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <zephyr/kernel.h>
@@ -223,6 +224,131 @@ static int small_8_1K_cust(void)
 	return custom_write_test("small 8x1K bigfile", &testfs_small_mnt, &cfg, 1024, 8);
 }
 
+#define CONC_WORKERS 2
+#define CONC_STACK_SIZE 2048
+#define CONC_CHUNK 64
+#define CONC_CHUNKS 128
+
+static K_THREAD_STACK_ARRAY_DEFINE(conc_stacks, CONC_WORKERS, CONC_STACK_SIZE);
+static struct k_thread conc_threads[CONC_WORKERS];
+
+struct conc_worker {
+	struct testfs_path path;
+	bool write;
+	int rc;
+};
+
+static struct conc_worker conc_workers[CONC_WORKERS];
+
+static void conc_worker_fn(void *p1, void *p2, void *p3)
+{
+	struct conc_worker *wp = p1;
+	struct fs_file_t file;
+	uint8_t buf[CONC_CHUNK];
+	int rc;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, wp->path.path,
+		     wp->write ? (FS_O_CREATE | FS_O_WRITE) : FS_O_READ);
+	if (rc != 0) {
+		wp->rc = rc;
+		return;
+	}
+
+	for (size_t i = 0; i < CONC_CHUNKS; ++i) {
+		if (wp->write) {
+			memset(buf, (uint8_t)i, sizeof(buf));
+			rc = fs_write(&file, buf, sizeof(buf));
+		} else {
+			rc = fs_read(&file, buf, sizeof(buf));
+			if ((rc == sizeof(buf)) && (buf[0] != (uint8_t)i)) {
+				rc = -EIO;
+			}
+		}
+		if (rc != sizeof(buf)) {
+			wp->rc = (rc < 0) ? rc : -EIO;
+			(void)fs_close(&file);
+			return;
+		}
+	}
+
+	wp->rc = fs_close(&file);
+}
+
+static int concurrent_run(const char *tag, bool write)
+{
+	size_t total = CONC_WORKERS * CONC_CHUNKS * CONC_CHUNK;
+	uint32_t t0;
+	uint32_t t1;
+
+	t0 = k_uptime_get_32();
+	for (int i = 0; i < CONC_WORKERS; ++i) {
+		conc_workers[i].write = write;
+		conc_workers[i].rc = -EINPROGRESS;
+		k_thread_create(&conc_threads[i], conc_stacks[i],
+				K_THREAD_STACK_SIZEOF(conc_stacks[i]),
+				conc_worker_fn, &conc_workers[i], NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+	for (int i = 0; i < CONC_WORKERS; ++i) {
+		k_thread_join(&conc_threads[i], K_FOREVER);
+	}
+	t1 = k_uptime_get_32();
+
+	if (t1 == t0) {
+		t1++;
+	}
+
+	for (int i = 0; i < CONC_WORKERS; ++i) {
+		if (conc_workers[i].rc != 0) {
+			TC_PRINT("%s worker %d failed: %d\n", tag, i, conc_workers[i].rc);
+			return TC_FAIL;
+		}
+	}
+
+	TC_PRINT("%s %s %d * %u * %u = %zu bytes in %u ms: %u By/s\n",
+		 tag, write ? "write" : "read", CONC_WORKERS, CONC_CHUNKS,
+		 CONC_CHUNK, total, (t1 - t0),
+		 (uint32_t)(total * 1000U / (t1 - t0)));
+
+	return TC_PASS;
+}
+
+/* Several threads streaming small chunks to and from distinct files of
+ * one mount; shows the effect of CONFIG_FS_LITTLEFS_FILE_BUFFER_SIZE.
+ */
+static int concurrent_write_read(const char *tag, struct fs_mount_t *mp)
+{
+	int rv;
+
+	if (testfs_lfs_wipe_partition(mp) != TC_PASS) {
+		return TC_FAIL;
+	}
+
+	if (fs_mount(mp) != 0) {
+		return TC_FAIL;
+	}
+
+	for (int i = 0; i < CONC_WORKERS; ++i) {
+		char name[8];
+
+		snprintf(name, sizeof(name), "conc%d", i);
+		testfs_path_init(&conc_workers[i].path, mp, name, TESTFS_PATH_END);
+	}
+
+	rv = concurrent_run(tag, true);
+	if (rv == TC_PASS) {
+		rv = concurrent_run(tag, false);
+	}
+
+	(void)fs_unmount(mp);
+
+	return rv;
+}
+
 ZTEST(littlefs, test_lfs_perf)
 {
 	k_sleep(K_MSEC(100));   /* flush log messages */
@@ -232,6 +358,12 @@ ZTEST(littlefs, test_lfs_perf)
 		      TC_PASS,
 		      "failed");
 
+	k_sleep(K_MSEC(100));   /* flush log messages */
+	zassert_equal(concurrent_write_read("small concurrent",
+					    &testfs_small_mnt),
+		      TC_PASS,
+		      "failed");
+
 	if (IS_ENABLED(CONFIG_APP_TEST_CUSTOM)) {
 		k_sleep(K_MSEC(100));   /* flush log messages */
 		zassert_equal(small_8_1K_cust(), TC_PASS,
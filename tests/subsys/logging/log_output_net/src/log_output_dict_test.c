@@ -0,0 +1,127 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test dictionary based output for packet based backends
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+
+#include <zephyr/tc_util.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define TEST_FMT "test %d %s"
+#define TEST_ITERATIONS 64
+
+static uint8_t dict_mock_buffer[512];
+static uint8_t dict_output_buf[CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE];
+static uint32_t dict_mock_len;
+static uint32_t dict_mock_calls;
+
+static union {
+	struct log_msg msg;
+	uint8_t raw[256];
+} test_msg __aligned(Z_LOG_MSG_ALIGNMENT);
+
+static int dict_mock_output_func(uint8_t *buf, size_t size, void *ctx)
+{
+	if (dict_mock_len + size <= sizeof(dict_mock_buffer)) {
+		memcpy(&dict_mock_buffer[dict_mock_len], buf, size);
+	}
+	dict_mock_len += size;
+	dict_mock_calls++;
+
+	return size;
+}
+
+LOG_OUTPUT_DEFINE(log_output_dict, dict_mock_output_func,
+		  dict_output_buf, sizeof(dict_output_buf));
+
+static size_t test_msg_init(void)
+{
+	struct log_msg *msg = &test_msg.msg;
+	int plen;
+
+	memset(&test_msg, 0, sizeof(test_msg));
+	plen = cbprintf_package(msg->data, sizeof(test_msg) - sizeof(*msg), 0,
+				TEST_FMT, 1234, "dictionary");
+	zassert_true(plen > 0);
+
+	msg->hdr.desc.type = Z_LOG_MSG_LOG;
+	msg->hdr.desc.level = LOG_LEVEL_INF;
+	msg->hdr.desc.package_len = plen;
+	msg->hdr.timestamp = 1000000;
+
+	return plen;
+}
+
+static void dict_mock_reset(void)
+{
+	dict_mock_len = 0U;
+	dict_mock_calls = 0U;
+}
+
+ZTEST(test_log_output_dict, test_single_write)
+{
+	size_t plen = test_msg_init();
+	const struct log_dict_output_normal_msg_hdr_t *hdr =
+		(const struct log_dict_output_normal_msg_hdr_t *)dict_mock_buffer;
+
+	dict_mock_reset();
+	log_dict_output_msg_process(&log_output_dict, &test_msg.msg, 0);
+
+	zassert_equal(dict_mock_calls, 1, "message split in %u writes", dict_mock_calls);
+	zassert_equal(dict_mock_len, sizeof(*hdr) + plen);
+	zassert_equal(hdr->type, MSG_NORMAL);
+	zassert_equal(hdr->level, LOG_LEVEL_INF);
+	zassert_equal(hdr->package_len, plen);
+	zassert_mem_equal(&dict_mock_buffer[sizeof(*hdr)], test_msg.msg.data, plen);
+
+	dict_mock_reset();
+	log_dict_output_dropped_process(&log_output_dict, 3);
+
+	zassert_equal(dict_mock_calls, 1);
+	zassert_equal(dict_mock_len, sizeof(struct log_dict_output_dropped_msg_t));
+}
+
+/* Report size and processing time of one message in text and dictionary format */
+ZTEST(test_log_output_dict, test_text_vs_dict)
+{
+	uint32_t flags = LOG_OUTPUT_FLAG_TIMESTAMP | LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP |
+			 LOG_OUTPUT_FLAG_FORMAT_SYSLOG;
+	uint32_t text_len, dict_len;
+	uint32_t text_cycles, dict_cycles;
+	uint32_t start;
+
+	(void)test_msg_init();
+
+	dict_mock_reset();
+	start = k_cycle_get_32();
+	for (int i = 0; i < TEST_ITERATIONS; i++) {
+		log_output_msg_process(&log_output_dict, &test_msg.msg, flags);
+	}
+	text_cycles = (k_cycle_get_32() - start) / TEST_ITERATIONS;
+	text_len = dict_mock_len / TEST_ITERATIONS;
+
+	dict_mock_reset();
+	start = k_cycle_get_32();
+	for (int i = 0; i < TEST_ITERATIONS; i++) {
+		log_dict_output_msg_process(&log_output_dict, &test_msg.msg, flags);
+	}
+	dict_cycles = (k_cycle_get_32() - start) / TEST_ITERATIONS;
+	dict_len = dict_mock_len / TEST_ITERATIONS;
+
+	TC_PRINT("text:       %u bytes/message, %u cycles/message\n", text_len, text_cycles);
+	TC_PRINT("dictionary: %u bytes/message, %u cycles/message\n", dict_len, dict_cycles);
+
+	zassert_true(dict_len < text_len);
+}
+
+ZTEST_SUITE(test_log_output_dict, NULL, NULL, NULL, NULL, NULL);
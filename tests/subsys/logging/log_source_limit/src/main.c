@@ -0,0 +1,276 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/sys/cbprintf.h>
+
+#define MAX_MSGS 16
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_DBG);
+
+struct test_str {
+	char *str;
+	int cnt;
+};
+
+static char msgs[MAX_MSGS][64];
+static uint32_t msg_cnt;
+
+static int out(int c, void *ctx)
+{
+	struct test_str *s = ctx;
+
+	if (s->cnt < (sizeof(msgs[0]) - 1)) {
+		s->str[s->cnt++] = (char)c;
+	}
+
+	return c;
+}
+
+static void process(const struct log_backend *const backend, union log_msg_generic *msg)
+{
+	struct test_str s;
+	size_t len;
+	uint8_t *package = log_msg_get_package(&msg->log, &len);
+
+	if (msg_cnt < MAX_MSGS) {
+		s.str = msgs[msg_cnt];
+		s.cnt = 0;
+		(void)cbpprintf(out, &s, package);
+		s.str[s.cnt] = '\0';
+	}
+
+	msg_cnt++;
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api test_backend_api = {
+	.process = process,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(test_backend, test_backend_api, true);
+
+static int16_t source_id(void)
+{
+	return log_source_id_get(STRINGIFY(test));
+}
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+}
+
+#define zassert_msg(idx, exp)                                                                      \
+	zassert_str_equal(msgs[idx], exp, "msg %d: \"%s\" (exp: \"%s\")", idx, msgs[idx], exp)
+
+static void log_burst(int cnt)
+{
+	for (int i = 0; i < cnt; i++) {
+		LOG_INF("burst %d", i);
+	}
+}
+
+static void log_repeat(int cnt, int arg)
+{
+	for (int i = 0; i < cnt; i++) {
+		LOG_INF("repeat %d", arg);
+	}
+}
+
+ZTEST(log_source_limit, test_api)
+{
+	int16_t id = source_id();
+
+	zassert_true(id >= 0);
+
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT)) {
+		uint16_t rate, burst;
+
+		zassert_equal(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, id, 10, 0), -EINVAL);
+		zassert_equal(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, -1, 10, 5), -EINVAL);
+		zassert_equal(log_source_ratelimit_set(1, id, 10, 5), -ENOTSUP);
+		zassert_ok(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, id, 10, 5));
+		zassert_ok(log_source_ratelimit_get(Z_LOG_LOCAL_DOMAIN_ID, id, &rate, &burst));
+		zassert_equal(rate, 10);
+		zassert_equal(burst, 5);
+	} else {
+		zassert_equal(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, id, 10, 5), -ENOTSUP);
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) {
+		zassert_false(log_source_dedup_get(Z_LOG_LOCAL_DOMAIN_ID, id));
+		zassert_ok(log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, id, true));
+		zassert_true(log_source_dedup_get(Z_LOG_LOCAL_DOMAIN_ID, id));
+	} else {
+		zassert_equal(log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, id, true), -ENOTSUP);
+	}
+}
+
+ZTEST(log_source_limit, test_no_limit)
+{
+	log_burst(10);
+	flush();
+
+	zassert_equal(msg_cnt, 10);
+	zassert_msg(9, "burst 9");
+}
+
+ZTEST(log_source_limit, test_dedup)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_SOURCE_DEDUP);
+
+	zassert_ok(log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, source_id(), true));
+
+	log_repeat(10, 1);
+	LOG_INF("other");
+	flush();
+
+	zassert_equal(msg_cnt, 3);
+	zassert_msg(0, "repeat 1");
+	zassert_msg(1, "Last message repeated 9 times");
+	zassert_msg(2, "other");
+}
+
+ZTEST(log_source_limit, test_dedup_arguments)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_SOURCE_DEDUP);
+
+	char str[] = "a";
+	uint8_t data[] = { 1, 2, 3 };
+
+	zassert_ok(log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, source_id(), true));
+
+	/* Messages from the same call site with different arguments are all logged. */
+	log_burst(3);
+	log_repeat(2, 1);
+	log_repeat(1, 2);
+	flush();
+
+	zassert_equal(msg_cnt, 6);
+	zassert_msg(0, "burst 0");
+	zassert_msg(1, "burst 1");
+	zassert_msg(2, "burst 2");
+	zassert_msg(3, "repeat 1");
+	zassert_msg(4, "Last message repeated 1 times");
+	zassert_msg(5, "repeat 2");
+
+	/* Strings are compared by content. */
+	for (int i = 0; i < 2; i++) {
+		LOG_INF("str %s", str);
+	}
+	str[0] = 'b';
+	LOG_INF("str %s", str);
+	flush();
+
+	zassert_equal(msg_cnt, 9);
+	zassert_msg(6, "str a");
+	zassert_msg(7, "Last message repeated 1 times");
+	zassert_msg(8, "str b");
+
+	/* Hexdump data is compared as well. */
+	for (int i = 0; i < 2; i++) {
+		LOG_HEXDUMP_INF(data, sizeof(data), "data");
+	}
+	data[2] = 4;
+	LOG_HEXDUMP_INF(data, sizeof(data), "data");
+	flush();
+
+	zassert_equal(msg_cnt, 12);
+	zassert_msg(9, "data");
+	zassert_msg(10, "Last message repeated 1 times");
+	zassert_msg(11, "data");
+}
+
+ZTEST(log_source_limit, test_dedup_period)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_SOURCE_DEDUP);
+
+	zassert_ok(log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, source_id(), true));
+
+	log_repeat(5, 0);
+	flush();
+	zassert_equal(msg_cnt, 1);
+
+	/* Source went quiet, repetitions are reported once the period expires. */
+	k_msleep(Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS + 10);
+	flush();
+	zassert_equal(msg_cnt, 2);
+	zassert_msg(1, "Last message repeated 4 times");
+
+	/* Same message logged again after the report is not suppressed. */
+	log_repeat(1, 0);
+	flush();
+	zassert_equal(msg_cnt, 3);
+	zassert_msg(2, "repeat 0");
+}
+
+ZTEST(log_source_limit, test_ratelimit)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_LOG_SOURCE_RATELIMIT);
+
+	zassert_ok(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, source_id(), 10, 5));
+
+	log_burst(20);
+	flush();
+	zassert_equal(msg_cnt, 5);
+	zassert_msg(4, "burst 4");
+
+	/* 10 messages per second, 2 tokens after 200 ms. */
+	k_msleep(200);
+	log_burst(3);
+	flush();
+	zassert_equal(msg_cnt, 8);
+	zassert_msg(5, "15 messages dropped by rate limit");
+	zassert_msg(6, "burst 0");
+	zassert_msg(7, "burst 1");
+
+	/* Dropped messages are reported even if source stopped logging. */
+	k_msleep(MAX(Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS, 100) + 10);
+	flush();
+	zassert_equal(msg_cnt, 9);
+	zassert_msg(8, "1 messages dropped by rate limit");
+
+	zassert_ok(log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, source_id(), 0, 5));
+	log_burst(10);
+	flush();
+	zassert_equal(msg_cnt, 19);
+}
+
+static void before(void *unused)
+{
+	int16_t id = source_id();
+
+	flush();
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT)) {
+		(void)log_source_ratelimit_set(Z_LOG_LOCAL_DOMAIN_ID, id, 0, 1);
+	}
+	if (IS_ENABLED(CONFIG_LOG_SOURCE_DEDUP)) {
+		(void)log_source_dedup_set(Z_LOG_LOCAL_DOMAIN_ID, id, false);
+	}
+	/* Let pending reports expire. */
+	k_msleep(Z_LOG_SOURCE_LIMIT_FLUSH_PERIOD_MS + 10);
+	flush();
+	msg_cnt = 0;
+}
+
+static void *setup(void)
+{
+	log_init();
+
+	return NULL;
+}
+
+ZTEST_SUITE(log_source_limit, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,191 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/irq_offload.h>
+#include <zephyr/kernel.h>
+#include <zephyr/metrics/metrics.h>
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_METRICS_PROMETHEUS
+#include <zephyr/net/prometheus/formatter.h>
+#endif
+
+METRICS_COUNTER_DEFINE(test_counter, "Test counter");
+METRICS_HISTOGRAM_DEFINE(test_histogram, "Test histogram");
+
+static void check_bucket(uint32_t value)
+{
+	uint32_t idx = metrics_histogram_index(value);
+
+	zassert_true(idx < METRICS_HISTOGRAM_BUCKETS, "value %u", value);
+	zassert_true(value <= metrics_histogram_bucket_max(idx), "value %u idx %u", value, idx);
+	if (idx > 0) {
+		zassert_true(value > metrics_histogram_bucket_max(idx - 1), "value %u idx %u",
+			     value, idx);
+	}
+}
+
+ZTEST(metrics, test_histogram_buckets)
+{
+	uint32_t prev = 0;
+
+	for (uint32_t v = 0; v < 70000; v++) {
+		check_bucket(v);
+	}
+
+	for (uint32_t bit = 16; bit < 32; bit++) {
+		check_bucket(BIT(bit) - 1U);
+		check_bucket(BIT(bit));
+		check_bucket(BIT(bit) + 1U);
+	}
+	check_bucket(UINT32_MAX);
+
+	/* Bounds are increasing and values below 2^SUB_BITS are exact */
+	for (uint32_t i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++) {
+		uint32_t max = metrics_histogram_bucket_max(i);
+
+		/* The last bucket is unreachable when values fit on MAX_BITS */
+		zassert_true(i == 0 || max > prev ||
+			     (i == METRICS_HISTOGRAM_BUCKETS - 1 && max == UINT32_MAX),
+			     "bucket %u", i);
+		prev = max;
+	}
+
+	for (uint32_t v = 0; v < BIT(METRICS_HISTOGRAM_SUB_BITS); v++) {
+		zassert_equal(metrics_histogram_index(v), v);
+	}
+
+	zassert_equal(metrics_histogram_bucket_max(METRICS_HISTOGRAM_BUCKETS - 2),
+		      (uint32_t)(BIT64(METRICS_HISTOGRAM_MAX_BITS) - 1U));
+	zassert_equal(metrics_histogram_bucket_max(METRICS_HISTOGRAM_BUCKETS - 1), UINT32_MAX);
+
+	if (METRICS_HISTOGRAM_MAX_BITS < 32) {
+		zassert_equal(metrics_histogram_index(UINT32_MAX), METRICS_HISTOGRAM_BUCKETS - 1);
+	}
+}
+
+static void counter_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	metrics_counter_add(&test_counter, 10U);
+	metrics_histogram_observe(&test_histogram, 1000U);
+}
+
+ZTEST(metrics, test_counter)
+{
+	metrics_counter_reset(&test_counter);
+	zassert_equal(metrics_counter_get(&test_counter), 0);
+
+	metrics_counter_inc(&test_counter);
+	metrics_counter_add(&test_counter, 41U);
+	zassert_equal(metrics_counter_get(&test_counter), 42);
+	zassert_equal(metrics_counter_get(&test_counter), 42);
+
+	irq_offload(counter_isr, NULL);
+	zassert_equal(metrics_counter_get(&test_counter), 52);
+
+	metrics_counter_reset(&test_counter);
+	zassert_equal(metrics_counter_get(&test_counter), 0);
+	metrics_counter_inc(&test_counter);
+	zassert_equal(metrics_counter_get(&test_counter), 1);
+
+	zassert_equal_ptr(metrics_counter_get_by_name("test_counter"), &test_counter);
+	zassert_is_null(metrics_counter_get_by_name("test_missing"));
+}
+
+ZTEST(metrics, test_histogram)
+{
+	static const uint32_t values[] = { 0, 1, 5, 5, 100, 1000, 123456 };
+	struct metrics_histogram_snapshot snapshot;
+	uint64_t sum = 0;
+
+	metrics_histogram_reset(&test_histogram);
+
+	ARRAY_FOR_EACH(values, i) {
+		metrics_histogram_observe(&test_histogram, values[i]);
+		sum += values[i];
+	}
+
+	irq_offload(counter_isr, NULL);
+	sum += 1000U;
+
+	metrics_histogram_snapshot(&test_histogram, &snapshot);
+	zassert_equal(snapshot.count, ARRAY_SIZE(values) + 1);
+	zassert_equal(snapshot.sum, sum);
+	zassert_equal(snapshot.buckets[metrics_histogram_index(5)], 2);
+	zassert_equal(snapshot.buckets[metrics_histogram_index(1000)], 2);
+	zassert_equal(snapshot.buckets[metrics_histogram_index(123456)], 1);
+
+	/* Reading does not consume anything */
+	metrics_histogram_snapshot(&test_histogram, &snapshot);
+	zassert_equal(snapshot.count, ARRAY_SIZE(values) + 1);
+	zassert_equal(snapshot.sum, sum);
+
+	metrics_histogram_reset(&test_histogram);
+	metrics_histogram_snapshot(&test_histogram, &snapshot);
+	zassert_equal(snapshot.count, 0);
+	zassert_equal(snapshot.sum, 0);
+
+	metrics_histogram_observe(&test_histogram, 7U);
+	metrics_histogram_snapshot(&test_histogram, &snapshot);
+	zassert_equal(snapshot.count, 1);
+	zassert_equal(snapshot.sum, 7);
+
+	zassert_equal_ptr(metrics_histogram_get_by_name("test_histogram"), &test_histogram);
+}
+
+ZTEST(metrics, test_kernel)
+{
+	struct metrics_counter *switches = metrics_counter_get_by_name("kernel_context_switches");
+	struct metrics_histogram *run = metrics_histogram_get_by_name("kernel_thread_run_cycles");
+	struct metrics_histogram_snapshot snapshot;
+	uint64_t before;
+
+	zassert_not_null(switches);
+	zassert_not_null(run);
+
+	before = metrics_counter_get(switches);
+	k_msleep(1);
+	k_msleep(1);
+	zassert_true(metrics_counter_get(switches) >= before + 2);
+
+	metrics_histogram_snapshot(run, &snapshot);
+	zassert_true(snapshot.count >= 2);
+}
+
+#ifdef CONFIG_METRICS_PROMETHEUS
+ZTEST(metrics, test_prometheus)
+{
+	static char buf[32768];
+	int ret;
+
+	metrics_counter_reset(&test_counter);
+	metrics_counter_add(&test_counter, 3U);
+	metrics_histogram_reset(&test_histogram);
+	metrics_histogram_observe(&test_histogram, 2U);
+	metrics_histogram_observe(&test_histogram, 100000U);
+
+	ret = prometheus_format_exposition(metrics_prometheus_collector(), buf, sizeof(buf));
+	zassert_ok(ret);
+
+	zassert_not_null(strstr(buf, "# TYPE test_counter counter\n"));
+	zassert_not_null(strstr(buf, "test_counter{board=\"" CONFIG_BOARD "\"} 3\n"));
+	zassert_not_null(strstr(buf, "# TYPE test_histogram histogram\n"));
+	zassert_not_null(strstr(buf, "test_histogram_bucket{le=\"2.000000\"} 1\n"), "%s", buf);
+	zassert_not_null(strstr(buf, "test_histogram_bucket{le=\"+Inf\"} 2\n"));
+	zassert_not_null(strstr(buf, "test_histogram_sum 100002.000000\n"));
+	zassert_not_null(strstr(buf, "test_histogram_count 2\n"));
+
+	zassert_not_null(strstr(buf, "kernel_context_switches{"));
+	zassert_not_null(strstr(buf, "net_pkt_allocs{"));
+	zassert_not_null(strstr(buf, "net_socket_send_cycles_count"));
+}
+#endif
+
+ZTEST_SUITE(metrics, NULL, NULL, NULL, NULL, NULL);
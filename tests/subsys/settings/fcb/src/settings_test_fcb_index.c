@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "settings_test.h"
+#include "settings/settings_fcb.h"
+
+#define TEST_INDEX_SIZE 64
+
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+/* Entries are tagged with the FNV-1a hash of the setting name */
+static uint32_t test_name_hash(const struct fcb *fcb, const struct fcb_entry *loc)
+{
+	uint32_t hash = 2166136261U;
+
+	for (uint16_t i = 0; i < loc->fe_data_len; i++) {
+		uint8_t c;
+		int rc;
+
+		rc = flash_area_read(fcb->fap, loc->fe_sector->fs_off + loc->fe_data_off + i,
+				     &c, sizeof(c));
+		zassert_true(rc == 0, "flash read error");
+		if (c == '=') {
+			break;
+		}
+		hash = (hash ^ c) * 16777619U;
+	}
+
+	return hash;
+}
+
+/* Check the index against a scan of the flash by an FCB without index */
+static void test_config_fcb_index_check(struct settings_fcb *cf)
+{
+	static struct fcb scan_fcb;
+	struct fcb_entry indexed = { 0 };
+	struct fcb_entry scanned = { 0 };
+	int cnt = 0;
+	int rc;
+
+	(void)memset(&scan_fcb, 0, sizeof(scan_fcb));
+	scan_fcb.f_magic = CONFIG_SETTINGS_FCB_MAGIC;
+	scan_fcb.f_version = cf->cf_fcb.f_version;
+	scan_fcb.f_sectors = cf->cf_fcb.f_sectors;
+	scan_fcb.f_sector_cnt = cf->cf_fcb.f_sector_cnt;
+	scan_fcb.f_scratch_cnt = cf->cf_fcb.f_scratch_cnt;
+	rc = fcb_init(cf->cf_fcb.fap->fa_id, &scan_fcb);
+	zassert_true(rc == 0, "fcb_init call failure");
+
+	while (fcb_getnext(&scan_fcb, &scanned) == 0) {
+		struct fcb_entry loc = { 0 };
+		bool found = false;
+
+		/* Walking the settings FCB is served by the index */
+		rc = fcb_getnext(&cf->cf_fcb, &indexed);
+		zassert_true(rc == 0, "entry %d missing from the index", cnt);
+		zassert_equal(indexed.fe_sector, scanned.fe_sector, "wrong sector");
+		zassert_equal(indexed.fe_elem_off, scanned.fe_elem_off, "wrong offset");
+		zassert_equal(indexed.fe_data_off, scanned.fe_data_off, "wrong data offset");
+		zassert_equal(indexed.fe_data_len, scanned.fe_data_len, "wrong data length");
+
+		while (!found &&
+		       fcb_index_find(&cf->cf_fcb, test_name_hash(&scan_fcb, &scanned), &loc) == 0) {
+			found = (loc.fe_sector == scanned.fe_sector &&
+				 loc.fe_elem_off == scanned.fe_elem_off);
+		}
+		zassert_true(found, "entry %d not found by name hash", cnt);
+		cnt++;
+	}
+
+	zassert_true(cnt > 0, "no entries");
+	zassert_equal(fcb_getnext(&cf->cf_fcb, &indexed), -ENOTSUP,
+		      "more entries in the index than in flash");
+}
+#endif /* CONFIG_SETTINGS_FCB_INDEX */
+
+ZTEST(settings_config_fcb, test_config_fcb_index)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SETTINGS_FCB_INDEX);
+#ifdef CONFIG_SETTINGS_FCB_INDEX
+	static struct fcb_index_entry index[TEST_INDEX_SIZE];
+	struct settings_fcb cf;
+	uint8_t val;
+	int rc;
+
+	rc = settings_register(&c_test_handlers[0]);
+	zassert_true(rc == 0 || rc == -EEXIST, "settings_register fail");
+	config_wipe_srcs();
+	config_wipe_fcb(fcb_sectors, ARRAY_SIZE(fcb_sectors));
+
+	cf.cf_fcb.f_magic = CONFIG_SETTINGS_FCB_MAGIC;
+	cf.cf_fcb.f_sectors = fcb_sectors;
+	cf.cf_fcb.f_sector_cnt = ARRAY_SIZE(fcb_sectors);
+
+	rc = settings_fcb_src(&cf);
+	zassert_true(rc == 0, "can't register FCB as configuration source");
+	settings_mount_fcb_backend(&cf);
+
+	rc = settings_fcb_index_attach(&cf, index, ARRAY_SIZE(index));
+	zassert_true(rc == 0, "can't attach the index");
+
+	rc = settings_fcb_dst(&cf);
+	zassert_true(rc == 0,
+		     "can't register FCB as configuration destination");
+
+	for (int i = 0; i < 12; i++) {
+		/* Unchanged values are found as duplicates through the index */
+		val = i / 2;
+		rc = settings_save_one("myfoo/mybar", &val, sizeof(val));
+		zassert_true(rc == 0, "fcb one item write error");
+
+		val = i % 3;
+		rc = settings_save_one("myfoo/other", &val, sizeof(val));
+		zassert_true(rc == 0, "fcb one item write error");
+	}
+
+	test_config_fcb_index_check(&cf);
+
+	val8 = 0U;
+	rc = settings_load();
+	zassert_true(rc == 0, "fcb read error");
+	zassert_true(val8 == 5U, "bad value read");
+
+	/* A fresh source over the same flash rebuilds the same index */
+	config_wipe_srcs();
+	rc = settings_fcb_src(&cf);
+	zassert_true(rc == 0, "can't register FCB as configuration source");
+	rc = settings_fcb_index_attach(&cf, index, ARRAY_SIZE(index));
+	zassert_true(rc == 0, "can't attach the index");
+	test_config_fcb_index_check(&cf);
+
+	settings_unregister(&c_test_handlers[0]);
+#endif
+}
@@ -264,14 +264,6 @@ static struct settings_handler val3_settings = {
 	.h_commit = val3_commit,
 };
 
-/* helper routine to remove a handler from settings */
-int settings_deregister(struct settings_handler *handler)
-{
-	extern sys_slist_t settings_handlers;
-
-	return sys_slist_find_and_remove(&settings_handlers, &handler->node);
-}
-
 ZTEST(settings_functional, test_register_and_loading)
 {
 	int rc, err;
@@ -421,13 +413,13 @@ ZTEST(settings_functional, test_register_and_loading)
 
 	/* clean up by deregistering settings_handler */
 	rc = settings_deregister(&val1_settings);
-	zassert_true(rc, "deregistering val1_settings failed");
+	zassert_equal(rc, 0, "deregistering val1_settings failed");
 
 	rc = settings_deregister(&val2_settings);
-	zassert_true(rc, "deregistering val2_settings failed");
+	zassert_equal(rc, 0, "deregistering val2_settings failed");
 
 	rc = settings_deregister(&val3_settings);
-	zassert_true(rc, "deregistering val3_settings failed");
+	zassert_equal(rc, 0, "deregistering val3_settings failed");
 }
 
 int val123_set(const char *key, size_t len,
@@ -1326,3 +1318,64 @@ ZTEST(settings_functional, test_single_save)
 	settings_deregister(&first_settings);
 #endif
 }
+
+ZTEST(settings_functional, test_save_batch)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_SETTINGS_SAVE_BATCH);
+
+#if defined(CONFIG_SETTINGS_SAVE_BATCH)
+	int rc;
+	uint8_t val;
+	uint32_t val32;
+	uint8_t first = 0x11;
+	uint8_t second = 0x22;
+	uint32_t third = 0x33445566;
+	struct settings_batch_entry batch[] = {
+		{ .name = "batch/first", .value = &first, .val_len = sizeof(first) },
+		{ .name = "batch/second", .value = &second, .val_len = sizeof(second) },
+		{ .name = "batch/third", .value = &third, .val_len = sizeof(third) },
+	};
+
+	rc = settings_subsys_init();
+	zassert_equal(rc, 0, "subsys init failed");
+
+	rc = settings_save_batch(batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 0, "batch save failed %d", rc);
+
+	rc = settings_load_one("batch/first", &val, sizeof(val));
+	zassert_equal(rc, sizeof(val));
+	zassert_equal(val, first);
+	rc = settings_load_one("batch/second", &val, sizeof(val));
+	zassert_equal(rc, sizeof(val));
+	zassert_equal(val, second);
+	rc = settings_load_one("batch/third", &val32, sizeof(val32));
+	zassert_equal(rc, sizeof(val32));
+	zassert_equal(val32, third);
+
+	/* Update one item, keep one and delete one */
+	first = 0x12;
+	batch[2].value = NULL;
+	batch[2].val_len = 0;
+	rc = settings_save_batch(batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, 0, "batch save failed %d", rc);
+
+	rc = settings_load_one("batch/first", &val, sizeof(val));
+	zassert_equal(rc, sizeof(val));
+	zassert_equal(val, first);
+	rc = settings_load_one("batch/second", &val, sizeof(val));
+	zassert_equal(rc, sizeof(val));
+	zassert_equal(val, second);
+	rc = settings_get_val_len("batch/third");
+	zassert_equal(rc, 0, "deleted item still present");
+
+	/* Names must be unique within a batch */
+	batch[2].name = "batch/first";
+	rc = settings_save_batch(batch, ARRAY_SIZE(batch));
+	zassert_equal(rc, -EINVAL, "duplicate names accepted");
+
+	rc = settings_delete("batch/first");
+	zassert_equal(rc, 0);
+	rc = settings_delete("batch/second");
+	zassert_equal(rc, 0);
+#endif
+}
@@ -87,6 +87,24 @@ static void store_pending(struct k_work *work)
 	k_sem_give(&waitfor_work);
 }
 
+#define TEST_LOAD_HANDLERS (64)
+#define TEST_LOAD_KEYS     (256)
+
+static struct settings_handler load_handlers[TEST_LOAD_HANDLERS];
+static char load_handler_names[TEST_LOAD_HANDLERS][8];
+static uint32_t load_set_calls;
+
+static int load_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	uint32_t val;
+
+	if (read_cb(cb_arg, &val, sizeof(val)) == sizeof(val)) {
+		load_set_calls++;
+	}
+
+	return 0;
+}
+
 ZTEST_SUITE(settings_perf, NULL, NULL, NULL, NULL, NULL);
 
 ZTEST(settings_perf, test_performance)
@@ -132,3 +150,57 @@ ZTEST(settings_perf, test_performance)
 		zassert_equal(err, 0, "Scanning failed to stop (err %d)\n", err);
 	}
 }
+
+/* Benchmark of settings_load() with many handlers and many stored keys, this
+ * is dominated by matching every loaded key against the registered handlers.
+ */
+ZTEST(settings_perf, test_load_performance)
+{
+	int err;
+	char path[20];
+	uint32_t val;
+
+	err = settings_subsys_init();
+	zassert_equal(err, 0, "settings_backend_init failed %d", err);
+
+	for (int i = 0; i < TEST_LOAD_HANDLERS; i++) {
+		snprintk(load_handler_names[i], sizeof(load_handler_names[i]), "lh%03d", i);
+		load_handlers[i].name = load_handler_names[i];
+		load_handlers[i].h_set = load_set;
+		err = settings_register(&load_handlers[i]);
+		zassert_equal(err, 0, "settings_register failed %d", err);
+	}
+
+	for (int i = 0; i < TEST_LOAD_KEYS; i++) {
+		val = i;
+		snprintk(path, sizeof(path), "lh%03d/%04x", i % TEST_LOAD_HANDLERS, i);
+		err = settings_save_one(path, &val, sizeof(val));
+		zassert_equal(err, 0, "settings_save_one failed %d", err);
+	}
+
+	load_set_calls = 0;
+
+	uint32_t start = k_cycle_get_32();
+
+	err = settings_load();
+
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	zassert_equal(err, 0, "settings_load failed %d", err);
+	zassert_true(load_set_calls >= TEST_LOAD_KEYS, "only %u keys loaded", load_set_calls);
+
+	printk("*** loading of %u keys with %u handlers completed ***\n", load_set_calls,
+	       TEST_LOAD_HANDLERS);
+	printk("handler index: %s, load time: %u us\n",
+	       IS_ENABLED(CONFIG_SETTINGS_HANDLER_INDEX) ? "on" : "off",
+	       (uint32_t)k_cyc_to_us_floor64(cycles));
+
+	for (int i = 0; i < TEST_LOAD_KEYS; i++) {
+		snprintk(path, sizeof(path), "lh%03d/%04x", i % TEST_LOAD_HANDLERS, i);
+		(void)settings_delete(path);
+	}
+
+	for (int i = 0; i < TEST_LOAD_HANDLERS; i++) {
+		(void)settings_deregister(&load_handlers[i]);
+	}
+}
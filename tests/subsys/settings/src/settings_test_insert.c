@@ -17,9 +17,7 @@ void test_config_insert_x(int idx)
 
 int settings_unregister(struct settings_handler *handler)
 {
-	extern sys_slist_t settings_handlers;
-
-	return sys_slist_find_and_remove(&settings_handlers, &handler->node);
+	return settings_deregister(handler) == 0;
 }
 
 void test_config_insert2(void)
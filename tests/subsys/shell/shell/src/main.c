@@ -345,6 +345,42 @@ ZTEST(sh, test_shell_fprintf)
 		     "Expected string to contain '%s', got '%s'", expect, buf);
 }
 
+#ifdef CONFIG_SHELL_MACHINE_MODE
+ZTEST(sh, test_shell_machine_mode)
+{
+	static const uint32_t values[] = { 0x01020304, 0x05060708 };
+	static const uint8_t expect[] = {
+		SHELL_MACHINE_FRAME_START, SHELL_MACHINE_FRAME_OUT, 3, 0, 'a', 'b', '\n',
+		SHELL_MACHINE_FRAME_START, SHELL_MACHINE_FRAME_ERR, 2, 0, 'x', '\n',
+		SHELL_MACHINE_FRAME_START, SHELL_MACHINE_FRAME_BIN, sizeof(values), 0,
+	};
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	const char *buf;
+	size_t size;
+
+	zassert_equal(shell_machine_mode_set(sh, true), 0);
+	shell_backend_dummy_clear_output(sh);
+
+	shell_print(sh, "ab");
+	shell_error(sh, "x");
+	zassert_ok(shell_machine_write(sh, values, sizeof(values)));
+
+	buf = shell_backend_dummy_get_output(sh, &size);
+	zassert_equal(size, sizeof(expect) + sizeof(values));
+	zassert_mem_equal(buf, expect, sizeof(expect));
+	zassert_mem_equal(buf + sizeof(expect), values, sizeof(values));
+
+	zassert_equal(shell_machine_mode_set(sh, false), 1);
+	zassert_equal(shell_machine_write(sh, values, sizeof(values)), -ENOTSUP);
+
+	test_shell_execute_cmd("shell machine on", 0);
+	zassert_equal(shell_machine_mode_set(sh, false), 1);
+	test_shell_execute_cmd("shell machine on", 0);
+	test_shell_execute_cmd("shell machine off", 0);
+	zassert_equal(shell_machine_mode_set(sh, false), 0);
+}
+#endif
+
 static void test_bypass_cb(const struct shell *sh, uint8_t *data, size_t len,
 			   void *user_data)
 {
@@ -34,6 +34,7 @@ static uint8_t *cb_buf;
 static size_t cb_len;
 static size_t cb_offset;
 static int cb_ret;
+static int cb_sleep_ms;
 
 static const char progress_key[] = "sf-test/progress";
 
@@ -67,6 +68,11 @@ int stream_flash_callback(uint8_t *buf, size_t len, size_t offset)
 		zassert_equal(cb_offset, offset, "incorrect offset");
 	}
 
+	if (cb_sleep_ms) {
+		/* Keep a background write in progress */
+		k_msleep(cb_sleep_ms);
+	}
+
 	return cb_ret;
 }
 
@@ -105,6 +111,7 @@ static void init_target(void)
 	cb_offset = 0;
 	cb_buf = NULL;
 	cb_ret = 0;
+	cb_sleep_ms = 0;
 
 	erase_flash();
 
@@ -638,6 +645,110 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 #endif
 }
 
+ZTEST(lib_stream_flash, test_stream_flash_double_buffer)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_STREAM_FLASH_DOUBLE_BUFFER);
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	static uint8_t second_buf[BUF_LEN];
+	static uint8_t pattern[TESTBUF_SIZE];
+	size_t total = page_size * (MAX_NUM_PAGES - 1) + 100;
+	size_t chunk = 100;
+	int rc;
+
+	init_target();
+
+	rc = stream_flash_double_buffer_enable(&ctx, generic_buf);
+	zassert_equal(rc, -EFAULT, "same buffer twice should fail");
+
+	rc = stream_flash_double_buffer_enable(&ctx, second_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	for (size_t i = 0; i < total; i++) {
+		pattern[i] = (uint8_t)(i * 7 + (i >> 8));
+	}
+
+	for (size_t off = 0; off < total; off += chunk) {
+		rc = stream_flash_buffered_write(&ctx, pattern + off,
+						 MIN(chunk, total - off), false);
+		zassert_equal(rc, 0, "expected success");
+	}
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), total,
+		      "expected all bytes written");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0,
+		      "expected nothing buffered");
+
+	VERIFY_BUF(0, total, pattern);
+
+	/* Writing beyond the designated area is refused while data is queued */
+	init_target();
+	rc = stream_flash_double_buffer_enable(&ctx, second_buf);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, pattern, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, pattern, FLASH_AVAILABLE - BUF_LEN + 1, false);
+	zassert_equal(rc, -ENOMEM, "expected failure");
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+#endif
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_double_buffer_reinit)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_STREAM_FLASH_DOUBLE_BUFFER);
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	static uint8_t second_buf[BUF_LEN];
+	static uint8_t pattern[BUF_LEN * 3];
+	int rc;
+
+	for (size_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (uint8_t)(i * 3 + 1);
+	}
+
+	init_target();
+
+	for (int running = 0; running < 2; running++) {
+		rc = stream_flash_double_buffer_enable(&ctx, second_buf);
+		zassert_equal(rc, 0, "expected success");
+
+		cb_sleep_ms = running ? 50 : 0;
+		rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN + 10, false);
+		zassert_equal(rc, 0, "expected success");
+
+		if (running) {
+			/* Let the work queue start programming the buffer */
+			k_msleep(1);
+			zassert_true(k_work_busy_get(&ctx.work) & K_WORK_RUNNING,
+				     "expected write in progress");
+		} else {
+			zassert_true(k_work_is_pending(&ctx.work), "expected write queued");
+		}
+
+		/* Restart the stream from the beginning, as img_mgmt does when
+		 * an upload restarts at offset 0.
+		 */
+		rc = stream_flash_init(&ctx, fdev, generic_buf, BUF_LEN, FLASH_BASE,
+				       FLASH_AVAILABLE, stream_flash_callback);
+		zassert_equal(rc, 0, "expected success");
+		zassert_false(k_work_busy_get(&ctx.work), "expected no write left");
+		zassert_equal(stream_flash_bytes_written(&ctx), 0, "expected nothing written");
+		zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "expected nothing buffered");
+	}
+
+	cb_sleep_ms = 0;
+	rc = stream_flash_double_buffer_enable(&ctx, second_buf);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, pattern, sizeof(pattern) - 5, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), sizeof(pattern) - 5,
+		      "expected all bytes written");
+
+	VERIFY_BUF(0, sizeof(pattern) - 5, pattern);
+#endif
+}
+
 void lib_stream_flash_before(void *data)
 {
 	zassume_true(device_is_ready(fdev), "Device is not ready");
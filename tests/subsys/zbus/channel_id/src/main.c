@@ -49,6 +49,13 @@ ZTEST(channel_id, test_channel_retrieval)
 	/* Duplicate channel IDs */
 	zassert_true((&chan_b == zbus_chan_from_id(CHAN_B)) ||
 		     (&chan_d == zbus_chan_from_id(CHAN_B)));
+
+	/* Every channel with a unique ID */
+	STRUCT_SECTION_FOREACH(zbus_channel, chan) {
+		if ((chan->id != ZBUS_CHAN_ID_INVALID) && (chan->id != CHAN_B)) {
+			zassert_equal(chan, zbus_chan_from_id(chan->id), "%s", chan->name);
+		}
+	}
 }
 
 ZTEST_SUITE(channel_id, NULL, NULL, NULL, NULL, NULL);
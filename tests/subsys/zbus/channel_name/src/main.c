@@ -21,12 +21,25 @@ struct msg {
 
 LISTIFY(CHANNEL_COUNT, DEFINE_TEST_CHANNELS, (;))
 
+/* Names that are a prefix of other names, which the linker sorts differently than strcmp() */
+ZBUS_CHAN_DEFINE(chan, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(chan1, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(chanA, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(chan_, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(chan_a, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(chana, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+
 ZTEST(channel_name, test_channel_retrieval)
 {
 	/* invalid cases */
 	zexpect_is_null(zbus_chan_from_name("unknown"));
 	zexpect_is_null(zbus_chan_from_name(NULL));
 	zexpect_is_null(zbus_chan_from_name(""));
+	zexpect_is_null(zbus_chan_from_name("test_chan_"));
+	zexpect_is_null(zbus_chan_from_name("test_chan_00"));
+	zexpect_is_null(zbus_chan_from_name("test_chan_10"));
+	zexpect_is_null(zbus_chan_from_name("a"));
+	zexpect_is_null(zbus_chan_from_name("~"));
 
 	/* valid cases */
 	zexpect_equal_ptr(&test_chan_0, zbus_chan_from_name("test_chan_0"));
@@ -35,4 +48,29 @@ ZTEST(channel_name, test_channel_retrieval)
 	zexpect_equal_ptr(&test_chan_9, zbus_chan_from_name("test_chan_9"));
 }
 
+ZTEST(channel_name, test_channel_retrieval_prefix)
+{
+	/* invalid cases */
+	zexpect_is_null(zbus_chan_from_name("cha"));
+	zexpect_is_null(zbus_chan_from_name("chan0"));
+	zexpect_is_null(zbus_chan_from_name("chan__"));
+	zexpect_is_null(zbus_chan_from_name("chan_b"));
+	zexpect_is_null(zbus_chan_from_name("chanB"));
+
+	/* valid cases */
+	zexpect_equal_ptr(&chan, zbus_chan_from_name("chan"));
+	zexpect_equal_ptr(&chan1, zbus_chan_from_name("chan1"));
+	zexpect_equal_ptr(&chanA, zbus_chan_from_name("chanA"));
+	zexpect_equal_ptr(&chan_, zbus_chan_from_name("chan_"));
+	zexpect_equal_ptr(&chan_a, zbus_chan_from_name("chan_a"));
+	zexpect_equal_ptr(&chana, zbus_chan_from_name("chana"));
+}
+
+ZTEST(channel_name, test_channel_retrieval_all)
+{
+	STRUCT_SECTION_FOREACH(zbus_channel, chan) {
+		zexpect_equal_ptr(chan, zbus_chan_from_name(chan->name), "%s", chan->name);
+	}
+}
+
 ZTEST_SUITE(channel_name, NULL, NULL, NULL, NULL, NULL);
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <time.h>
+
 #include <zephyr/ztest.h>
 #include <zephyr/sys/crc.h>
 #include "../../../subsys/crc/crc8_sw.c"
@@ -74,6 +76,94 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Bit at a time reflected CRC-32, without the initial and final inversions */
+static uint32_t crc32_reflected_ref(uint32_t poly, uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+static uint8_t crc32_buf[65536 + 8];
+
+static void crc32_buf_fill(void)
+{
+	uint32_t x = 0x12345678U;
+
+	for (size_t i = 0; i < sizeof(crc32_buf); i++) {
+		x = x * 1103515245U + 12345U;
+		crc32_buf[i] = x >> 24;
+	}
+}
+
+ZTEST(crc, test_crc32_lengths_and_alignments)
+{
+	crc32_buf_fill();
+
+	/* Every length around the slice sizes, at every alignment */
+	for (size_t offset = 0; offset < 8; offset++) {
+		const uint8_t *data = &crc32_buf[offset];
+
+		for (size_t len = 0; len <= 72; len++) {
+			zassert_equal(crc32_ieee(data, len),
+				      ~crc32_reflected_ref(0xedb88320U, ~0U, data, len),
+				      "offset %zu len %zu", offset, len);
+			zassert_equal(crc32_c(0, data, len, true, true),
+				      ~crc32_reflected_ref(0x82f63b78U, ~0U, data, len),
+				      "offset %zu len %zu", offset, len);
+		}
+	}
+
+	/* Chaining with unaligned splits */
+	uint32_t crc = 0;
+	uint32_t crc_c = 0;
+
+	for (size_t done = 0, step = 1; done < 4096; done += step, step = step * 3 % 61 + 1) {
+		crc = crc32_ieee_update(crc, &crc32_buf[done], step);
+		crc_c = crc32_c(crc_c, &crc32_buf[done], step, done == 0, false);
+		if (done + step >= 4096) {
+			zassert_equal(crc, crc32_ieee(crc32_buf, done + step));
+			zassert_equal(crc_c ^ 0xffffffffU,
+				      crc32_c(0, crc32_buf, done + step, true, true));
+		}
+	}
+}
+
+/* Not a pass/fail test, reports the throughput of the configured implementation
+ * to compare the table sizes and the CPU instructions.
+ */
+ZTEST(crc, test_crc32_throughput)
+{
+	const size_t len = sizeof(crc32_buf) - 8;
+	const int rounds = 256;
+	volatile uint32_t sink = 0;
+	clock_t start;
+	double secs;
+
+	crc32_buf_fill();
+
+	start = clock();
+	for (int i = 0; i < rounds; i++) {
+		sink ^= crc32_ieee(&crc32_buf[i & 7], len);
+	}
+	secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	TC_PRINT("crc32_ieee: %.0f MB/s\n", secs > 0 ? rounds * len / secs / 1e6 : 0.0);
+
+	start = clock();
+	for (int i = 0; i < rounds; i++) {
+		sink ^= crc32_c(0, &crc32_buf[i & 7], len, true, true);
+	}
+	secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+	TC_PRINT("crc32_c: %.0f MB/s\n", secs > 0 ? rounds * len / secs / 1e6 : 0.0);
+
+	ARG_UNUSED(sink);
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };